@@ -4,7 +4,16 @@ dnl Version: 20240518
 
 dnl Function to detect if libbfio dependencies are available
 AC_DEFUN([AX_LIBBFIO_CHECK_LOCAL],
-  [dnl No additional checks.
+  [dnl Headers and functions used to determine the extents of sparse files,
+  dnl to pass access hints and to read at an offset
+  AC_CHECK_HEADERS([errno.h fcntl.h unistd.h])
+
+  AC_CHECK_FUNCS([lseek posix_fadvise pread])
+
+  dnl Headers and functions used to determine the maximum number of open handles
+  AC_CHECK_HEADERS([sys/resource.h])
+
+  AC_CHECK_FUNCS([getrlimit])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,114 @@
+/*
+ * IO operations definitions for libbfio
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_IO_OPERATIONS_H )
+#define _LIBBFIO_IO_OPERATIONS_H
+
+#include <libbfio/error.h>
+#include <libbfio/types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The IO operations of a handle
+ * A single table can be shared by all the handles of the same type
+ */
+typedef struct libbfio_io_operations libbfio_io_operations_t;
+
+struct libbfio_io_operations
+{
+	/* The free IO handle function
+	 */
+	int (*free_io_handle)(
+	       intptr_t **io_handle,
+	       libbfio_error_t **error );
+
+	/* The clone (duplicate) IO handle function
+	 */
+	int (*clone_io_handle)(
+	       intptr_t **destination_io_handle,
+	       intptr_t *source_io_handle,
+	       libbfio_error_t **error );
+
+	/* The open function
+	 */
+	int (*open)(
+	       intptr_t *io_handle,
+	       int access_flags,
+	       libbfio_error_t **error );
+
+	/* The close function
+	 */
+	int (*close)(
+	       intptr_t *io_handle,
+	       libbfio_error_t **error );
+
+	/* The read function
+	 */
+	ssize_t (*read)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           libbfio_error_t **error );
+
+	/* The write function
+	 */
+	ssize_t (*write)(
+	           intptr_t *io_handle,
+	           const uint8_t *buffer,
+	           size_t size,
+	           libbfio_error_t **error );
+
+	/* The seek offset function
+	 */
+	off64_t (*seek_offset)(
+	           intptr_t *io_handle,
+	           off64_t offset,
+	           int whence,
+	           libbfio_error_t **error );
+
+	/* The exists function
+	 */
+	int (*exists)(
+	       intptr_t *io_handle,
+	       libbfio_error_t **error );
+
+	/* The is open function
+	 */
+	int (*is_open)(
+	       intptr_t *io_handle,
+	       libbfio_error_t **error );
+
+	/* The get size function
+	 */
+	int (*get_size)(
+	       intptr_t *io_handle,
+	       size64_t *size,
+	       libbfio_error_t **error );
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_IO_OPERATIONS_H ) */
+
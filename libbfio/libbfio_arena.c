@@ -0,0 +1,369 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_arena.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_arena_initialize(
+     libbfio_arena_t **arena,
+     size_t slab_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slab_size == 0 )
+	 || ( slab_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slab size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libbfio_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libbfio_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *arena )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *arena )->slab_size = slab_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena including all the memory allocated from it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_arena_free(
+     libbfio_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libbfio_arena_slab_t *slab = NULL;
+	static char *function      = "libbfio_arena_free";
+	int result                 = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *arena )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		while( ( *arena )->slabs != NULL )
+		{
+			slab              = ( *arena )->slabs;
+			( *arena )->slabs = slab->next_slab;
+
+			memory_free(
+			 slab->data );
+
+			memory_free(
+			 slab );
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( result );
+}
+
+/* Allocates memory from an arena
+ * The memory is cleared and aligned and remains valid until the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_arena_allocate(
+     libbfio_arena_t *arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libbfio_arena_slab_t *slab = NULL;
+	static char *function      = "libbfio_arena_allocate";
+	size_t aligned_size        = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBBFIO_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + LIBBFIO_ARENA_ALIGNMENT - 1 ) & ~( (size_t) LIBBFIO_ARENA_ALIGNMENT - 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	slab = arena->slabs;
+
+	if( ( slab == NULL )
+	 || ( aligned_size > ( slab->data_size - slab->used_data_size ) ) )
+	{
+		slab = memory_allocate_structure(
+		        libbfio_arena_slab_t );
+
+		if( slab == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slab.",
+			 function );
+
+			goto on_error;
+		}
+		slab->used_data_size = 0;
+		slab->data_size      = arena->slab_size;
+
+		/* Allocations that exceed the slab size get a dedicated slab
+		 */
+		if( aligned_size > slab->data_size )
+		{
+			slab->data_size = aligned_size;
+		}
+		slab->data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * slab->data_size );
+
+		if( slab->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slab data.",
+			 function );
+
+			memory_free(
+			 slab );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     slab->data,
+		     0,
+		     slab->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slab data.",
+			 function );
+
+			memory_free(
+			 slab->data );
+
+			memory_free(
+			 slab );
+
+			goto on_error;
+		}
+		/* Keep the current slab first when it has more remaining space than the new slab
+		 */
+		if( ( arena->slabs != NULL )
+		 && ( ( arena->slabs->data_size - arena->slabs->used_data_size ) > ( slab->data_size - aligned_size ) ) )
+		{
+			slab->next_slab         = arena->slabs->next_slab;
+			arena->slabs->next_slab = slab;
+		}
+		else
+		{
+			slab->next_slab = arena->slabs;
+			arena->slabs    = slab;
+		}
+	}
+	*data = &( slab->data[ slab->used_data_size ] );
+
+	slab->used_data_size += aligned_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     arena->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_read_write_lock_release_for_write(
+	 arena->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
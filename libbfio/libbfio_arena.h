@@ -0,0 +1,103 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_ARENA_H )
+#define _LIBBFIO_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of an arena slab
+ */
+#define LIBBFIO_ARENA_DEFAULT_SLAB_SIZE		( 256 * 1024 )
+
+/* The alignment of allocations from an arena
+ */
+#define LIBBFIO_ARENA_ALIGNMENT			16
+
+typedef struct libbfio_arena_slab libbfio_arena_slab_t;
+
+struct libbfio_arena_slab
+{
+	/* The next slab
+	 */
+	libbfio_arena_slab_t *next_slab;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libbfio_arena libbfio_arena_t;
+
+struct libbfio_arena
+{
+	/* The slab size
+	 */
+	size_t slab_size;
+
+	/* The slabs, the most recently allocated slab is first
+	 */
+	libbfio_arena_slab_t *slabs;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libbfio_arena_initialize(
+     libbfio_arena_t **arena,
+     size_t slab_size,
+     libcerror_error_t **error );
+
+int libbfio_arena_free(
+     libbfio_arena_t **arena,
+     libcerror_error_t **error );
+
+int libbfio_arena_allocate(
+     libbfio_arena_t *arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_ARENA_H ) */
+
@@ -0,0 +1,129 @@
+/*
+ * Atomic functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_ATOMIC_H )
+#define _LIBBFIO_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The atomic loads and stores are used for values that are read without
+ * grabbing the read/write lock, the stores are still done while holding
+ * the lock for writing, the loads have acquire and the stores have release
+ * semantics. The increment is used for values that are shared by all handles
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+#if defined( __ATOMIC_ACQUIRE )
+#define HAVE_LIBBFIO_ATOMICS	1
+
+#define libbfio_atomic_load_int64( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libbfio_atomic_store_int64( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#define libbfio_atomic_load_int32( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libbfio_atomic_store_int32( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#define libbfio_atomic_load_uint8( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libbfio_atomic_store_uint8( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#define libbfio_atomic_increment_int64( value ) \
+	__atomic_add_fetch( value, 1, __ATOMIC_ACQ_REL )
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1700 )
+#define HAVE_LIBBFIO_ATOMICS	1
+
+#include <intrin.h>
+
+/* The interlocked functions imply a full memory barrier, the 8-bit
+ * variants are only available as compiler intrinsics
+ */
+#define libbfio_atomic_load_int64( value ) \
+	InterlockedCompareExchange64( (volatile LONG64 *) value, 0, 0 )
+
+#define libbfio_atomic_store_int64( value, new_value ) \
+	InterlockedExchange64( (volatile LONG64 *) value, (LONG64) new_value )
+
+#define libbfio_atomic_load_int32( value ) \
+	InterlockedCompareExchange( (volatile LONG *) value, 0, 0 )
+
+#define libbfio_atomic_store_int32( value, new_value ) \
+	InterlockedExchange( (volatile LONG *) value, (LONG) new_value )
+
+#define libbfio_atomic_load_uint8( value ) \
+	_InterlockedCompareExchange8( (volatile char *) value, 0, 0 )
+
+#define libbfio_atomic_store_uint8( value, new_value ) \
+	_InterlockedExchange8( (volatile char *) value, (char) new_value )
+
+#define libbfio_atomic_increment_int64( value ) \
+	InterlockedIncrement64( (volatile LONG64 *) value )
+
+#endif /* defined( __ATOMIC_ACQUIRE ) */
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+#if !defined( HAVE_LIBBFIO_ATOMICS )
+
+/* Without multi-thread support or atomics the values are only accessed
+ * while holding the read/write lock, hence plain loads and stores suffice
+ */
+#define libbfio_atomic_load_int64( value ) \
+	*( value )
+
+#define libbfio_atomic_store_int64( value, new_value ) \
+	*( value ) = new_value
+
+#define libbfio_atomic_load_int32( value ) \
+	*( value )
+
+#define libbfio_atomic_store_int32( value, new_value ) \
+	*( value ) = new_value
+
+#define libbfio_atomic_load_uint8( value ) \
+	*( value )
+
+#define libbfio_atomic_store_uint8( value, new_value ) \
+	*( value ) = new_value
+
+#define libbfio_atomic_increment_int64( value ) \
+	++( *( value ) )
+
+#endif /* !defined( HAVE_LIBBFIO_ATOMICS ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_ATOMIC_H ) */
+
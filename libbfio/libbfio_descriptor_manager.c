@@ -0,0 +1,1181 @@
+/*
+ * Descriptor manager functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#include "libbfio_definitions.h"
+#include "libbfio_descriptor_manager.h"
+#include "libbfio_file_io_handle.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcdata.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+/* Creates a descriptor manager
+ * The descriptor manager keeps track of the open handles of the pools
+ * and handles that share it and closes the least recently used handle
+ * when the maximum number of open handles is reached
+ * Use LIBBFIO_DESCRIPTOR_MANAGER_AUTOMATIC_NUMBER_OF_OPEN_HANDLES to determine
+ * the maximum number of open handles from the resource limits of the process
+ * Make sure the value descriptor_manager is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_initialize(
+     libbfio_descriptor_manager_t **descriptor_manager,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_initialize";
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	if( *descriptor_manager != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid descriptor manager value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles == LIBBFIO_DESCRIPTOR_MANAGER_AUTOMATIC_NUMBER_OF_OPEN_HANDLES )
+	{
+		if( libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+		     &maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve default maximum number of open handles.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_descriptor_manager = memory_allocate_structure(
+	                               libbfio_internal_descriptor_manager_t );
+
+	if( internal_descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create descriptor manager.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_descriptor_manager,
+	     0,
+	     sizeof( libbfio_internal_descriptor_manager_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear descriptor manager.",
+		 function );
+
+		memory_free(
+		 internal_descriptor_manager );
+
+		return( -1 );
+	}
+	if( libcdata_list_initialize(
+	     &( internal_descriptor_manager->last_used_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create last used list.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_descriptor_manager->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_descriptor_manager->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	*descriptor_manager = (libbfio_descriptor_manager_t *) internal_descriptor_manager;
+
+	return( 1 );
+
+on_error:
+	if( internal_descriptor_manager != NULL )
+	{
+		if( internal_descriptor_manager->last_used_list != NULL )
+		{
+			libcdata_list_free(
+			 &( internal_descriptor_manager->last_used_list ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_descriptor_manager );
+	}
+	return( -1 );
+}
+
+/* Frees a descriptor manager
+ * The descriptor manager must not be freed before the pools and handles that use it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_free(
+     libbfio_descriptor_manager_t **descriptor_manager,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	libbfio_internal_handle_t *internal_handle                         = NULL;
+	libcdata_list_element_t *last_used_list_element                    = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_free";
+	int result                                                         = 1;
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	if( *descriptor_manager != NULL )
+	{
+		internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) *descriptor_manager;
+		*descriptor_manager         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_descriptor_manager->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* Make sure the handles that are still open no longer reference the last used list
+		 */
+		if( libcdata_list_get_first_element(
+		     internal_descriptor_manager->last_used_list,
+		     &last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first list element from last used list.",
+			 function );
+
+			result = -1;
+		}
+		while( last_used_list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     last_used_list_element,
+			     (intptr_t **) &internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from last used list element.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			if( internal_handle != NULL )
+			{
+				internal_handle->descriptor_manager_list_element = NULL;
+			}
+			if( libcdata_list_element_get_next_element(
+			     last_used_list_element,
+			     &last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next last used list element.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( libcdata_list_free(
+		     &( internal_descriptor_manager->last_used_list ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free last used list.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_descriptor_manager );
+	}
+	return( result );
+}
+
+/* Retrieves the default maximum number of open handles
+ * The default is determined from the soft limit of the number of open files (RLIMIT_NOFILE)
+ * of the process, leaving part of the descriptors for use by the rest of the process
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_GETRLIMIT ) && defined( RLIMIT_NOFILE )
+	struct rlimit resource_limit;
+#endif
+
+	static char *function              = "libbfio_descriptor_manager_get_default_maximum_number_of_open_handles";
+	int number_of_descriptors          = LIBBFIO_DESCRIPTOR_MANAGER_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_HANDLES;
+	int number_of_reserved_descriptors = 0;
+
+	if( maximum_number_of_open_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_GETRLIMIT ) && defined( RLIMIT_NOFILE )
+	if( getrlimit(
+	     RLIMIT_NOFILE,
+	     &resource_limit ) == 0 )
+	{
+		if( ( resource_limit.rlim_cur == RLIM_INFINITY )
+		 || ( resource_limit.rlim_cur > (rlim_t) INT_MAX ) )
+		{
+			number_of_descriptors = INT_MAX;
+		}
+		else
+		{
+			number_of_descriptors = (int) resource_limit.rlim_cur;
+		}
+		/* Leave a quarter of the descriptors, up to a maximum,
+		 * for use by the rest of the process
+		 */
+		number_of_reserved_descriptors = number_of_descriptors / 4;
+
+		if( number_of_reserved_descriptors > LIBBFIO_DESCRIPTOR_MANAGER_MAXIMUM_NUMBER_OF_RESERVED_DESCRIPTORS )
+		{
+			number_of_reserved_descriptors = LIBBFIO_DESCRIPTOR_MANAGER_MAXIMUM_NUMBER_OF_RESERVED_DESCRIPTORS;
+		}
+		number_of_descriptors -= number_of_reserved_descriptors;
+
+		/* An open file IO handle can use more than 1 file descriptor
+		 */
+		number_of_descriptors /= LIBBFIO_FILE_IO_HANDLE_NUMBER_OF_DESCRIPTORS;
+	}
+#endif
+	if( number_of_descriptors < 1 )
+	{
+		number_of_descriptors = 1;
+	}
+	*maximum_number_of_open_handles = number_of_descriptors;
+
+	return( 1 );
+}
+
+/* Closes the least recently used handles until the number of open handles
+ * does not exceed the maximum
+ * Handles that are in use are not closed, hence the number of open handles
+ * can exceed the maximum when all the open handles are in use
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_descriptor_manager_close_least_recently_used_handles(
+     libbfio_internal_descriptor_manager_t *internal_descriptor_manager,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle           = NULL;
+	libcdata_list_element_t *last_used_list_element      = NULL;
+	libcdata_list_element_t *previous_list_element       = NULL;
+	libcdata_list_element_t *safe_last_used_list_element = NULL;
+	static char *function                                = "libbfio_internal_descriptor_manager_close_least_recently_used_handles";
+
+	if( internal_descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_descriptor_manager->number_of_open_handles <= maximum_number_of_open_handles )
+	{
+		return( 1 );
+	}
+	if( libcdata_list_get_last_element(
+	     internal_descriptor_manager->last_used_list,
+	     &last_used_list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last list element from last used list.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( last_used_list_element != NULL )
+	    && ( internal_descriptor_manager->number_of_open_handles > maximum_number_of_open_handles ) )
+	{
+		if( libcdata_list_element_get_previous_element(
+		     last_used_list_element,
+		     &previous_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous last used list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_get_value(
+		     last_used_list_element,
+		     (intptr_t **) &internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from last used list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing last used list element value.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->descriptor_manager_number_of_users == 0 )
+		{
+			if( libcdata_list_remove_element(
+			     internal_descriptor_manager->last_used_list,
+			     last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last used list element from list.",
+				 function );
+
+				return( -1 );
+			}
+			safe_last_used_list_element = last_used_list_element;
+
+			internal_handle->descriptor_manager_list_element = NULL;
+
+			internal_descriptor_manager->number_of_open_handles -= 1;
+
+			if( libcdata_list_element_free(
+			     &safe_last_used_list_element,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free last used list element.",
+				 function );
+
+				return( -1 );
+			}
+			/* A handle that was already closed is not an error
+			 */
+			if( libbfio_internal_handle_close_if_open(
+			     internal_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		last_used_list_element = previous_list_element;
+	}
+	return( 1 );
+}
+
+/* Acquires a handle
+ * Adds the handle to the front of the last used list, closing the least recently used
+ * handles if necessary, and prevents the handle from being closed by the descriptor
+ * manager until it is released
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_acquire_handle(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	libbfio_internal_handle_t *internal_handle                         = NULL;
+	libcdata_list_element_t *first_list_element                        = NULL;
+	libcdata_list_element_t *last_used_list_element                    = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_acquire_handle";
+	int result                                                         = 1;
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) descriptor_manager;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	/* The handle must refer to the descriptor manager so that it is removed
+	 * from the descriptor manager when it is closed or freed
+	 */
+	if( internal_handle->descriptor_manager != descriptor_manager )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle - descriptor manager value mismatch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->descriptor_manager_list_element == NULL )
+	{
+		if( libbfio_internal_descriptor_manager_close_least_recently_used_handles(
+		     internal_descriptor_manager,
+		     internal_descriptor_manager->maximum_number_of_open_handles - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to close least recently used handles.",
+			 function );
+
+			result = -1;
+		}
+		else if( libcdata_list_element_initialize(
+		          &last_used_list_element,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create last used list element.",
+			 function );
+
+			result = -1;
+		}
+		else if( libcdata_list_element_set_value(
+		          last_used_list_element,
+		          (intptr_t *) handle,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value in last used list element.",
+			 function );
+
+			result = -1;
+		}
+		else if( libcdata_list_prepend_element(
+		          internal_descriptor_manager->last_used_list,
+		          last_used_list_element,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend last used list element to list.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			if( last_used_list_element != NULL )
+			{
+				libcdata_list_element_free(
+				 &last_used_list_element,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			internal_handle->descriptor_manager_list_element = last_used_list_element;
+
+			internal_descriptor_manager->number_of_open_handles += 1;
+		}
+	}
+	else
+	{
+		if( libcdata_list_get_first_element(
+		     internal_descriptor_manager->last_used_list,
+		     &first_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first list element from last used list.",
+			 function );
+
+			result = -1;
+		}
+		else if( internal_handle->descriptor_manager_list_element != first_list_element )
+		{
+			last_used_list_element = internal_handle->descriptor_manager_list_element;
+
+			if( libcdata_list_remove_element(
+			     internal_descriptor_manager->last_used_list,
+			     last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last used list element from list.",
+				 function );
+
+				result = -1;
+			}
+			else if( libcdata_list_prepend_element(
+			          internal_descriptor_manager->last_used_list,
+			          last_used_list_element,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to prepend last used list element to list.",
+				 function );
+
+				/* The element is no longer part of the list
+				 */
+				libcdata_list_element_free(
+				 &last_used_list_element,
+				 NULL,
+				 NULL );
+
+				internal_handle->descriptor_manager_list_element = NULL;
+
+				internal_descriptor_manager->number_of_open_handles -= 1;
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->descriptor_manager_number_of_users += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a handle that was acquired
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_release_handle(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	libbfio_internal_handle_t *internal_handle                         = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_release_handle";
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) descriptor_manager;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->descriptor_manager_number_of_users > 0 )
+	{
+		internal_handle->descriptor_manager_number_of_users -= 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes a handle from the last used list
+ * This is used when the handle is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_remove_handle(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	libbfio_internal_handle_t *internal_handle                         = NULL;
+	libcdata_list_element_t *last_used_list_element                    = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_remove_handle";
+	int result                                                         = 1;
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) descriptor_manager;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->descriptor_manager_list_element != NULL )
+	{
+		last_used_list_element = internal_handle->descriptor_manager_list_element;
+
+		if( libcdata_list_remove_element(
+		     internal_descriptor_manager->last_used_list,
+		     last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last used list element from list.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			internal_handle->descriptor_manager_list_element = NULL;
+
+			internal_descriptor_manager->number_of_open_handles -= 1;
+
+			if( libcdata_list_element_free(
+			     &last_used_list_element,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free last used list element.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_get_number_of_open_handles(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     int *number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_get_number_of_open_handles";
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) descriptor_manager;
+
+	if( number_of_open_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_open_handles = internal_descriptor_manager->number_of_open_handles;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum number of open handles
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_get_maximum_number_of_open_handles";
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) descriptor_manager;
+
+	if( maximum_number_of_open_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_open_handles = internal_descriptor_manager->maximum_number_of_open_handles;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of open handles
+ * Use LIBBFIO_DESCRIPTOR_MANAGER_AUTOMATIC_NUMBER_OF_OPEN_HANDLES to determine
+ * the maximum number of open handles from the resource limits of the process
+ * Closes the least recently used handles if the number of open handles exceeds the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_descriptor_manager_set_maximum_number_of_open_handles(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_descriptor_manager_t *internal_descriptor_manager = NULL;
+	static char *function                                              = "libbfio_descriptor_manager_set_maximum_number_of_open_handles";
+	int result                                                         = 1;
+
+	if( descriptor_manager == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor manager.",
+		 function );
+
+		return( -1 );
+	}
+	internal_descriptor_manager = (libbfio_internal_descriptor_manager_t *) descriptor_manager;
+
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles == LIBBFIO_DESCRIPTOR_MANAGER_AUTOMATIC_NUMBER_OF_OPEN_HANDLES )
+	{
+		if( libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+		     &maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve default maximum number of open handles.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_descriptor_manager->maximum_number_of_open_handles = maximum_number_of_open_handles;
+
+	if( libbfio_internal_descriptor_manager_close_least_recently_used_handles(
+	     internal_descriptor_manager,
+	     maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to close least recently used handles.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_descriptor_manager->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Descriptor manager functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_DESCRIPTOR_MANAGER_H )
+#define _LIBBFIO_DESCRIPTOR_MANAGER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_libcdata.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of open handles if it cannot be determined
+ * from the resource limits of the process
+ */
+#define LIBBFIO_DESCRIPTOR_MANAGER_DEFAULT_MAXIMUM_NUMBER_OF_OPEN_HANDLES	1024
+
+/* The maximum number of descriptors that are left for use by the rest of the process
+ */
+#define LIBBFIO_DESCRIPTOR_MANAGER_MAXIMUM_NUMBER_OF_RESERVED_DESCRIPTORS	64
+
+typedef struct libbfio_internal_descriptor_manager libbfio_internal_descriptor_manager_t;
+
+struct libbfio_internal_descriptor_manager
+{
+	/* The number of open handles
+	 */
+	int number_of_open_handles;
+
+	/* The maximum number of open handles
+	 */
+	int maximum_number_of_open_handles;
+
+	/* A list containing the open handles in order of the last use
+	 * it starts with the last used at the beginning of the list
+	 * the value of the list element refers to the corresponding handle
+	 */
+	libcdata_list_t *last_used_list;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_manager_initialize(
+     libbfio_descriptor_manager_t **descriptor_manager,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_manager_free(
+     libbfio_descriptor_manager_t **descriptor_manager,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int libbfio_internal_descriptor_manager_close_least_recently_used_handles(
+     libbfio_internal_descriptor_manager_t *internal_descriptor_manager,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_manager_acquire_handle(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_manager_release_handle(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+int libbfio_descriptor_manager_remove_handle(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_manager_get_number_of_open_handles(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     int *number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     int *maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_descriptor_manager_set_maximum_number_of_open_handles(
+     libbfio_descriptor_manager_t *descriptor_manager,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_DESCRIPTOR_MANAGER_H ) */
+
@@ -0,0 +1,212 @@
+/*
+ * Extent functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_extent.h"
+#include "libbfio_libcdata.h"
+#include "libbfio_libcerror.h"
+
+/* Creates an extent
+ * Make sure the value extent is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_extent_initialize(
+     libbfio_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_extent_initialize";
+
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent = memory_allocate_structure(
+	           libbfio_extent_t );
+
+	if( *extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent,
+	     0,
+	     sizeof( libbfio_extent_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent != NULL )
+	{
+		memory_free(
+		 *extent );
+
+		*extent = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_extent_free(
+     libbfio_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_extent_free";
+
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent != NULL )
+	{
+		memory_free(
+		 *extent );
+
+		*extent = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an extent and appends it to an extents array
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_extent_append_to_array(
+     libcdata_array_t *extents_array,
+     off64_t offset,
+     size64_t size,
+     uint32_t flags,
+     libcerror_error_t **error )
+{
+	libbfio_extent_t *extent = NULL;
+	static char *function    = "libbfio_extent_append_to_array";
+	int entry_index          = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_extent_initialize(
+	     &extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent.",
+		 function );
+
+		goto on_error;
+	}
+	extent->offset = offset;
+	extent->size   = size;
+	extent->flags  = flags;
+
+	if( libcdata_array_append_entry(
+	     extents_array,
+	     &entry_index,
+	     (intptr_t *) extent,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append extent to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libbfio_extent_free(
+		 &extent,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -23,14 +23,32 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libbfio_arena.h"
 #include "libbfio_definitions.h"
 #include "libbfio_file.h"
 #include "libbfio_file_io_handle.h"
 #include "libbfio_handle.h"
+#include "libbfio_io_operations.h"
+#include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcpath.h"
 #include "libbfio_types.h"
 
+/* The file IO operations
+ */
+static const libbfio_io_operations_t libbfio_file_io_operations = {
+	(int (*)(intptr_t **, libcerror_error_t **)) libbfio_file_io_handle_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_clone,
+	(int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_file_io_handle_open,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_close,
+	(ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_file_io_handle_read_buffer,
+	(ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_file_io_handle_write_buffer,
+	(off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_file_io_handle_seek_offset,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_exists,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_is_open,
+	(int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_file_io_handle_get_size
+};
+
 /* Creates a file handle
  * Make sure the value handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -38,9 +56,27 @@
 int libbfio_file_initialize(
      libbfio_handle_t **handle,
      libcerror_error_t **error )
+{
+	return( libbfio_file_initialize_in_arena(
+	         handle,
+	         NULL,
+	         0,
+	         error ) );
+}
+
+/* Creates a file handle
+ * If an arena is provided the handle and file IO handle are allocated from the arena
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_initialize_in_arena(
+     libbfio_handle_t **handle,
+     libbfio_arena_t *arena,
+     uint8_t flags,
+     libcerror_error_t **error )
 {
 	libbfio_file_io_handle_t *file_io_handle = NULL;
-	static char *function                    = "libbfio_file_initialize";
+	static char *function                    = "libbfio_file_initialize_in_arena";
 
 	if( handle == NULL )
 	{
@@ -64,8 +100,9 @@ int libbfio_file_initialize(
 
 		return( -1 );
 	}
-	if( libbfio_file_io_handle_initialize(
+	if( libbfio_file_io_handle_initialize_in_arena(
 	     &file_io_handle,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -77,20 +114,12 @@ int libbfio_file_initialize(
 
 		goto on_error;
 	}
-	if( libbfio_handle_initialize(
+	if( libbfio_handle_initialize_in_arena(
 	     handle,
+	     arena,
 	     (intptr_t *) file_io_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_file_io_handle_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_clone,
-	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_file_io_handle_open,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_close,
-	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_file_io_handle_read_buffer,
-	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_file_io_handle_write_buffer,
-	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_file_io_handle_seek_offset,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_exists,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_io_handle_is_open,
-	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_file_io_handle_get_size,
-	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     &libbfio_file_io_operations,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION | flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -102,6 +131,62 @@ int libbfio_file_initialize(
 
 		goto on_error;
 	}
+	if( libbfio_handle_set_get_extents_function(
+	     *handle,
+	     (int (*)(intptr_t *, libcdata_array_t *, libcerror_error_t **)) libbfio_file_io_handle_get_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set get extents function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_access_hint_function(
+	     *handle,
+	     (int (*)(intptr_t *, int, off64_t, size64_t, libcerror_error_t **)) libbfio_file_io_handle_set_access_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET )
+	if( libbfio_handle_set_read_at_offset_function(
+	     *handle,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, libcerror_error_t **)) libbfio_file_io_handle_read_buffer_at_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read at offset function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
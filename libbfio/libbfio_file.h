@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libbfio_arena.h"
 #include "libbfio_extern.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_types.h"
@@ -38,6 +39,12 @@ int libbfio_file_initialize(
      libbfio_handle_t **handle,
      libcerror_error_t **error );
 
+int libbfio_file_initialize_in_arena(
+     libbfio_handle_t **handle,
+     libbfio_arena_t *arena,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_file_get_name_size(
      libbfio_handle_t *handle,
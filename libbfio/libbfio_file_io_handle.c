@@ -26,8 +26,23 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_arena.h"
 #include "libbfio_definitions.h"
+#include "libbfio_extent.h"
 #include "libbfio_file_io_handle.h"
+#include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcfile.h"
 #include "libbfio_system_string.h"
@@ -40,7 +55,23 @@ int libbfio_file_io_handle_initialize(
      libbfio_file_io_handle_t **file_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libbfio_file_io_handle_initialize";
+	return( libbfio_file_io_handle_initialize_in_arena(
+	         file_io_handle,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a file IO handle
+ * If an arena is provided the file IO handle is allocated from the arena
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_file_io_handle_initialize_in_arena(
+     libbfio_file_io_handle_t **file_io_handle,
+     libbfio_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_initialize_in_arena";
 
 	if( file_io_handle == NULL )
 	{
@@ -64,33 +95,57 @@ int libbfio_file_io_handle_initialize(
 
 		return( -1 );
 	}
-	*file_io_handle = memory_allocate_structure(
-	                   libbfio_file_io_handle_t );
-
-	if( *file_io_handle == NULL )
+	if( arena != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file IO handle.",
-		 function );
+		/* Memory allocated from an arena is cleared
+		 */
+		if( libbfio_arena_allocate(
+		     arena,
+		     sizeof( libbfio_file_io_handle_t ),
+		     (uint8_t **) file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file IO handle.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
+		( *file_io_handle )->is_arena_allocated = 1;
 	}
-	if( memory_set(
-	     *file_io_handle,
-	     0,
-	     sizeof( libbfio_file_io_handle_t ) ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear file IO handle.",
-		 function );
+		*file_io_handle = memory_allocate_structure(
+		                   libbfio_file_io_handle_t );
 
-		goto on_error;
+		if( *file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     *file_io_handle,
+		     0,
+		     sizeof( libbfio_file_io_handle_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libcfile_file_initialize(
 	     &( ( *file_io_handle )->file ),
@@ -105,14 +160,19 @@ int libbfio_file_io_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	( *file_io_handle )->descriptor = -1;
+#endif
 	return( 1 );
 
 on_error:
 	if( *file_io_handle != NULL )
 	{
-		memory_free(
-		 *file_io_handle );
-
+		if( ( *file_io_handle )->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 *file_io_handle );
+		}
 		*file_io_handle = NULL;
 	}
 	return( -1 );
@@ -146,6 +206,13 @@ int libbfio_file_io_handle_free(
 			memory_free(
 			 ( *file_io_handle )->name );
 		}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+		if( ( *file_io_handle )->descriptor != -1 )
+		{
+			close(
+			 ( *file_io_handle )->descriptor );
+		}
+#endif
 		if( libcfile_file_free(
 		     &( ( *file_io_handle )->file ),
 		     error ) != 1 )
@@ -159,9 +226,13 @@ int libbfio_file_io_handle_free(
 
 			result = -1;
 		}
-		memory_free(
-		 *file_io_handle );
-
+		/* Memory allocated from an arena is freed with the arena
+		 */
+		if( ( *file_io_handle )->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 *file_io_handle );
+		}
 		*file_io_handle = NULL;
 	}
 	return( result );
@@ -288,6 +359,8 @@ int libbfio_file_io_handle_clone(
 
 		( *destination_file_io_handle )->name_size = source_file_io_handle->name_size;
 	}
+	( *destination_file_io_handle )->access_behavior = source_file_io_handle->access_behavior;
+
 	return( 1 );
 
 on_error:
@@ -830,6 +903,60 @@ int libbfio_file_io_handle_open(
 
 		return( -1 );
 	}
+	if( file_io_handle->access_behavior != LIBCFILE_ACCESS_BEHAVIOR_NORMAL )
+	{
+		if( libcfile_file_set_access_behavior(
+		     file_io_handle->file,
+		     file_io_handle->access_behavior,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access behavior.",
+			 function );
+
+			libcfile_file_close(
+			 file_io_handle->file,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	/* The file descriptor is opened directly after the file, so that it refers
+	 * to the same file, when it cannot be opened no access hints are applied
+	 */
+	if( file_io_handle->descriptor == -1 )
+	{
+		file_io_handle->descriptor = open(
+		                              file_io_handle->name,
+		                              O_RDONLY );
+	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET )
+	/* Reading at an offset requires the file descriptor
+	 */
+	if( ( file_io_handle->descriptor == -1 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) != 0 ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file descriptor of file: %" PRIs_SYSTEM ".",
+		 function,
+		 file_io_handle->name );
+
+		libcfile_file_close(
+		 file_io_handle->file,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+#endif
 	file_io_handle->access_flags = access_flags;
 
 	return( 1 );
@@ -880,6 +1007,15 @@ int libbfio_file_io_handle_close(
 
 		return( -1 );
 	}
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	if( file_io_handle->descriptor != -1 )
+	{
+		close(
+		 file_io_handle->descriptor );
+
+		file_io_handle->descriptor = -1;
+	}
+#endif
 	file_io_handle->access_flags = 0;
 
 	return( 0 );
@@ -940,6 +1076,105 @@ ssize_t libbfio_file_io_handle_read_buffer(
 	return( read_count );
 }
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET )
+
+/* Reads a buffer from the file handle at a specific offset
+ * The data is read from the file descriptor that is kept open together with
+ * the file, hence the offset of the file is not changed
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_file_io_handle_read_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (off64_t) (off_t) offset != offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = pread(
+	              file_io_handle->descriptor,
+	              buffer,
+	              size,
+	              (off_t) offset );
+
+	if( read_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 errno,
+		 "%s: unable to read from file: %" PRIs_SYSTEM " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_io_handle->name,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET ) */
+
 /* Writes a buffer to the file handle
  * Returns the number of bytes written if successful, or -1 on error
  */
@@ -1196,3 +1431,391 @@ int libbfio_file_io_handle_get_size(
 	return( 1 );
 }
 
+/* Passes an access hint for the file
+ * The normal, sequential and random access hints apply to the entire file
+ * and are retained when the file is reopened. The will need and do not need
+ * access hints apply to the range defined by offset and size, where a size
+ * of 0 represents the remainder of the file, and are only applied when the file is open
+ * Returns 1 if successful, 0 if not supported or not applied or -1 on error
+ */
+int libbfio_file_io_handle_set_access_hint(
+     libbfio_file_io_handle_t *file_io_handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_set_access_hint";
+	int access_behavior   = 0;
+	int is_open           = 0;
+
+#if defined( HAVE_POSIX_FADVISE ) && defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	int advice            = 0;
+	int result            = 0;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( access_hint )
+	{
+		case LIBBFIO_ACCESS_HINT_NORMAL:
+			access_behavior = LIBCFILE_ACCESS_BEHAVIOR_NORMAL;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_SEQUENTIAL:
+			access_behavior = LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_RANDOM:
+			access_behavior = LIBCFILE_ACCESS_BEHAVIOR_RANDOM;
+			break;
+
+		case LIBBFIO_ACCESS_HINT_WILLNEED:
+		case LIBBFIO_ACCESS_HINT_DONTNEED:
+			access_behavior = -1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access hint.",
+			 function );
+
+			return( -1 );
+	}
+	if( access_behavior != -1 )
+	{
+		is_open = libcfile_file_is_open(
+		           file_io_handle->file,
+		           error );
+
+		if( is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file is open.",
+			 function );
+
+			return( -1 );
+		}
+		else if( is_open != 0 )
+		{
+			if( libcfile_file_set_access_behavior(
+			     file_io_handle->file,
+			     access_behavior,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set access behavior.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		file_io_handle->access_behavior = access_behavior;
+
+		return( 1 );
+	}
+#if defined( HAVE_POSIX_FADVISE ) && defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	/* The access hint is passed on the file descriptor of the open file,
+	 * when the file is not open no access hint is applied
+	 */
+	if( file_io_handle->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( ( (off64_t) (off_t) offset != offset )
+	 || ( (size64_t) (off_t) size != size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset or size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_hint == LIBBFIO_ACCESS_HINT_WILLNEED )
+	{
+		advice = POSIX_FADV_WILLNEED;
+	}
+	else
+	{
+		advice = POSIX_FADV_DONTNEED;
+	}
+	result = posix_fadvise(
+	          file_io_handle->descriptor,
+	          (off_t) offset,
+	          (off_t) size,
+	          advice );
+
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 (uint32_t) result,
+		 "%s: unable to pass access hint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the extents of the file
+ * The extents are appended to the extents array as data and hole (sparse) ranges
+ * Holes are determined using SEEK_DATA and SEEK_HOLE, which libcfile does not
+ * support, on the file descriptor that is kept open together with the file
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libbfio_file_io_handle_get_extents(
+     libbfio_file_io_handle_t *file_io_handle,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_io_handle_get_extents";
+
+	int is_open           = 0;
+
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE ) && defined( HAVE_LSEEK ) && defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	size64_t size         = 0;
+	off64_t data_offset   = 0;
+	off64_t file_size     = 0;
+	off64_t hole_offset   = 0;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extents_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents array.",
+		 function );
+
+		return( -1 );
+	}
+	is_open = libcfile_file_is_open(
+	           file_io_handle->file,
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE ) && defined( HAVE_LSEEK ) && defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	/* Without the file descriptor the extents cannot be determined
+	 */
+	if( file_io_handle->descriptor == -1 )
+	{
+		return( 0 );
+	}
+	/* The size of the file is used so that the extents match the size
+	 * that is reported for the file
+	 */
+	if( libcfile_file_get_size(
+	     file_io_handle->file,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_size = (off64_t) size;
+
+	while( hole_offset < file_size )
+	{
+		data_offset = lseek(
+		               file_io_handle->descriptor,
+		               hole_offset,
+		               SEEK_DATA );
+
+		if( data_offset < 0 )
+		{
+			if( errno == ENXIO )
+			{
+				/* The remainder of the file is a hole
+				 */
+				data_offset = file_size;
+			}
+			else if( ( errno == EINVAL )
+			      && ( hole_offset == 0 ) )
+			{
+				/* The file system does not support SEEK_DATA
+				 */
+				return( 0 );
+			}
+			else
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 errno,
+				 "%s: unable to seek data from offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 hole_offset,
+				 hole_offset );
+
+				return( -1 );
+			}
+		}
+		if( data_offset > hole_offset )
+		{
+			if( libbfio_extent_append_to_array(
+			     extents_array,
+			     hole_offset,
+			     (size64_t) ( data_offset - hole_offset ),
+			     LIBBFIO_EXTENT_FLAG_IS_SPARSE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append hole extent.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( data_offset >= file_size )
+		{
+			break;
+		}
+		hole_offset = lseek(
+		               file_io_handle->descriptor,
+		               data_offset,
+		               SEEK_HOLE );
+
+		if( hole_offset < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 errno,
+			 "%s: unable to seek hole from offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			return( -1 );
+		}
+		if( hole_offset > file_size )
+		{
+			hole_offset = file_size;
+		}
+		if( libbfio_extent_append_to_array(
+		     extents_array,
+		     data_offset,
+		     (size64_t) ( hole_offset - data_offset ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data extent.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
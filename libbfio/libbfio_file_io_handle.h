@@ -25,6 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_arena.h"
+#include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcfile.h"
 
@@ -32,6 +38,28 @@
 extern "C" {
 #endif
 
+/* The file IO handle keeps a file descriptor of its own on platforms that
+ * support access hints, extents or positional reads, since libcfile does
+ * not expose its file descriptor
+ */
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( defined( HAVE_POSIX_FADVISE ) || defined( HAVE_PREAD ) || ( defined( SEEK_DATA ) && defined( SEEK_HOLE ) && defined( HAVE_LSEEK ) ) )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR	1
+#endif
+
+/* Reading at an offset without changing the offset of the file requires pread
+ */
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR ) && defined( HAVE_PREAD )
+#define LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET	1
+#endif
+
+/* The number of file descriptors used by an open file IO handle
+ */
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+#define LIBBFIO_FILE_IO_HANDLE_NUMBER_OF_DESCRIPTORS	2
+#else
+#define LIBBFIO_FILE_IO_HANDLE_NUMBER_OF_DESCRIPTORS	1
+#endif
+
 typedef struct libbfio_file_io_handle libbfio_file_io_handle_t;
 
 struct libbfio_file_io_handle
@@ -48,15 +76,35 @@ struct libbfio_file_io_handle
 	 */
 	libcfile_file_t *file;
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_DESCRIPTOR )
+	/* The file descriptor used for access hints and extents, which is opened
+	 * and closed together with the file, -1 if not open
+	 */
+	int descriptor;
+#endif
+
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The access behavior, which is applied when the file is opened
+	 */
+	int access_behavior;
+
+	/* Value to indicate the file IO handle was allocated from an arena
+	 */
+	uint8_t is_arena_allocated;
 };
 
 int libbfio_file_io_handle_initialize(
      libbfio_file_io_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int libbfio_file_io_handle_initialize_in_arena(
+     libbfio_file_io_handle_t **file_io_handle,
+     libbfio_arena_t *arena,
+     libcerror_error_t **error );
+
 int libbfio_file_io_handle_free(
      libbfio_file_io_handle_t **file_io_handle,
      libcerror_error_t **error );
@@ -119,6 +167,17 @@ ssize_t libbfio_file_io_handle_read_buffer(
          size_t size,
          libcerror_error_t **error );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET )
+
+ssize_t libbfio_file_io_handle_read_buffer_at_offset(
+         libbfio_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET ) */
+
 ssize_t libbfio_file_io_handle_write_buffer(
          libbfio_file_io_handle_t *file_io_handle,
          const uint8_t *buffer,
@@ -144,6 +203,18 @@ int libbfio_file_io_handle_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+int libbfio_file_io_handle_set_access_hint(
+     libbfio_file_io_handle_t *file_io_handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libbfio_file_io_handle_get_extents(
+     libbfio_file_io_handle_t *file_io_handle,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
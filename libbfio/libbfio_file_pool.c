@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
@@ -42,9 +43,10 @@ int libbfio_file_pool_open(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libbfio_file_pool_open";
-	size_t name_length               = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_file_pool_open";
+	size_t name_length                     = 0;
 
 	if( pool == NULL )
 	{
@@ -57,6 +59,8 @@ int libbfio_file_pool_open(
 
 		return( -1 );
 	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
 	if( name == NULL )
 	{
 		libcerror_error_set(
@@ -68,8 +72,10 @@ int libbfio_file_pool_open(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
+	if( libbfio_file_initialize_in_arena(
 	     &file_io_handle,
+	     internal_pool->arena,
+	     internal_pool->handle_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -154,9 +160,10 @@ int libbfio_file_pool_open_wide(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libbfio_file_pool_open_wide";
-	size_t name_length               = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_file_pool_open_wide";
+	size_t name_length                     = 0;
 
 	if( pool == NULL )
 	{
@@ -169,6 +176,8 @@ int libbfio_file_pool_open_wide(
 
 		return( -1 );
 	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
 	if( name == NULL )
 	{
 		libcerror_error_set(
@@ -180,8 +189,10 @@ int libbfio_file_pool_open_wide(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
+	if( libbfio_file_initialize_in_arena(
 	     &file_io_handle,
+	     internal_pool->arena,
+	     internal_pool->handle_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -266,11 +277,12 @@ int libbfio_file_pool_append_handles_for_names(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libbfio_file_pool_append_handles_for_names";
-	size_t name_length               = 0;
-	int pool_entry                   = 0;
-	int name_iterator                = 0;
+	libbfio_handle_t **file_io_handles     = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_file_pool_append_handles_for_names";
+	size_t name_length                     = 0;
+	int name_iterator                      = 0;
+	int pool_entry                         = 0;
 
 	if( pool == NULL )
 	{
@@ -283,6 +295,8 @@ int libbfio_file_pool_append_handles_for_names(
 
 		return( -1 );
 	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
 	if( names == NULL )
 	{
 		libcerror_error_set(
@@ -305,6 +319,51 @@ int libbfio_file_pool_append_handles_for_names(
 
 		return( -1 );
 	}
+	if( (size_t) number_of_names > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of names value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The handles are created up front so that they can be appended
+	 * to the pool at once
+	 */
+	file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                         sizeof( libbfio_handle_t * ) * number_of_names );
+
+	if( file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * number_of_names ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		memory_free(
+		 file_io_handles );
+
+		return( -1 );
+	}
 	for( name_iterator = 0;
 	     name_iterator < number_of_names;
 	     name_iterator++ )
@@ -312,8 +371,10 @@ int libbfio_file_pool_append_handles_for_names(
 		name_length = narrow_string_length(
 		               names[ name_iterator ] );
 
-		if( libbfio_file_initialize(
-		     &file_io_handle,
+		if( libbfio_file_initialize_in_arena(
+		     &( file_io_handles[ name_iterator ] ),
+		     internal_pool->arena,
+		     internal_pool->handle_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -324,10 +385,10 @@ int libbfio_file_pool_append_handles_for_names(
 			 function,
 			 name_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libbfio_file_set_name(
-		     file_io_handle,
+		     file_io_handles[ name_iterator ],
 		     names[ name_iterator ],
 		     name_length + 1,
 		     error ) != 1 )
@@ -340,36 +401,47 @@ int libbfio_file_pool_append_handles_for_names(
 			 function,
 			 name_iterator );
 
-			libbfio_handle_free(
-			 &file_io_handle,
-			 NULL );
-
-			return( -1 );
+			goto on_error;
 		}
-		if( libbfio_pool_append_handle(
-		     pool,
-		     &pool_entry,
-		     file_io_handle,
-		     access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append file IO handle: %d to pool.",
-			 function,
-			 name_iterator );
+	}
+	if( libbfio_pool_append_handles(
+	     pool,
+	     &pool_entry,
+	     file_io_handles,
+	     number_of_names,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handles to pool.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 file_io_handles );
 
+	return( 1 );
+
+on_error:
+	for( name_iterator = 0;
+	     name_iterator < number_of_names;
+	     name_iterator++ )
+	{
+		if( file_io_handles[ name_iterator ] != NULL )
+		{
 			libbfio_handle_free(
-			 &file_io_handle,
+			 &( file_io_handles[ name_iterator ] ),
 			 NULL );
-
-			return( -1 );
 		}
-		file_io_handle = NULL;
 	}
-	return( 1 );
+	memory_free(
+	 file_io_handles );
+
+	return( -1 );
 }
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
@@ -384,11 +456,12 @@ int libbfio_file_pool_append_handles_for_names_wide(
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libbfio_file_pool_append_handles_for_names_wide";
-	size_t name_length               = 0;
-	int pool_entry                   = 0;
-	int name_iterator                = 0;
+	libbfio_handle_t **file_io_handles     = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_file_pool_append_handles_for_names_wide";
+	size_t name_length                     = 0;
+	int name_iterator                      = 0;
+	int pool_entry                         = 0;
 
 	if( pool == NULL )
 	{
@@ -401,6 +474,8 @@ int libbfio_file_pool_append_handles_for_names_wide(
 
 		return( -1 );
 	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
 	if( names == NULL )
 	{
 		libcerror_error_set(
@@ -423,6 +498,51 @@ int libbfio_file_pool_append_handles_for_names_wide(
 
 		return( -1 );
 	}
+	if( (size_t) number_of_names > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of names value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The handles are created up front so that they can be appended
+	 * to the pool at once
+	 */
+	file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                         sizeof( libbfio_handle_t * ) * number_of_names );
+
+	if( file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * number_of_names ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		memory_free(
+		 file_io_handles );
+
+		return( -1 );
+	}
 	for( name_iterator = 0;
 	     name_iterator < number_of_names;
 	     name_iterator++ )
@@ -430,8 +550,10 @@ int libbfio_file_pool_append_handles_for_names_wide(
 		name_length = wide_string_length(
 		               names[ name_iterator ] );
 
-		if( libbfio_file_initialize(
-		     &file_io_handle,
+		if( libbfio_file_initialize_in_arena(
+		     &( file_io_handles[ name_iterator ] ),
+		     internal_pool->arena,
+		     internal_pool->handle_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -442,10 +564,10 @@ int libbfio_file_pool_append_handles_for_names_wide(
 			 function,
 			 name_iterator );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libbfio_file_set_name_wide(
-		     file_io_handle,
+		     file_io_handles[ name_iterator ],
 		     names[ name_iterator ],
 		     name_length + 1,
 		     error ) != 1 )
@@ -458,36 +580,47 @@ int libbfio_file_pool_append_handles_for_names_wide(
 			 function,
 			 name_iterator );
 
-			libbfio_handle_free(
-			 &file_io_handle,
-			 NULL );
-
-			return( -1 );
+			goto on_error;
 		}
-		if( libbfio_pool_append_handle(
-		     pool,
-		     &pool_entry,
-		     file_io_handle,
-		     access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append file IO handle: %d to pool.",
-			 function,
-			 name_iterator );
+	}
+	if( libbfio_pool_append_handles(
+	     pool,
+	     &pool_entry,
+	     file_io_handles,
+	     number_of_names,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handles to pool.",
+		 function );
 
+		goto on_error;
+	}
+	memory_free(
+	 file_io_handles );
+
+	return( 1 );
+
+on_error:
+	for( name_iterator = 0;
+	     name_iterator < number_of_names;
+	     name_iterator++ )
+	{
+		if( file_io_handles[ name_iterator ] != NULL )
+		{
 			libbfio_handle_free(
-			 &file_io_handle,
+			 &( file_io_handles[ name_iterator ] ),
 			 NULL );
-
-			return( -1 );
 		}
-		file_io_handle = NULL;
 	}
-	return( 1 );
+	memory_free(
+	 file_io_handles );
+
+	return( -1 );
 }
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
@@ -31,9 +31,25 @@
 #include "libbfio_file_range.h"
 #include "libbfio_file_range_io_handle.h"
 #include "libbfio_handle.h"
+#include "libbfio_io_operations.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_types.h"
 
+/* The file range IO operations
+ */
+static const libbfio_io_operations_t libbfio_file_range_io_operations = {
+	(int (*)(intptr_t **, libcerror_error_t **)) libbfio_file_range_io_handle_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_clone,
+	(int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_file_range_io_handle_open,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_close,
+	(ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_file_range_io_handle_read_buffer,
+	(ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_file_range_io_handle_write_buffer,
+	(off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_file_range_io_handle_seek_offset,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_exists,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_is_open,
+	(int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_file_range_io_handle_get_size
+};
+
 /* Creates a file range handle
  * Make sure the value handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -80,19 +96,10 @@ int libbfio_file_range_initialize(
 
 		goto on_error;
 	}
-	if( libbfio_handle_initialize(
+	if( libbfio_handle_initialize_with_operations(
 	     handle,
 	     (intptr_t *) file_range_io_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_file_range_io_handle_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_clone,
-	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_file_range_io_handle_open,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_close,
-	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_file_range_io_handle_read_buffer,
-	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_file_range_io_handle_write_buffer,
-	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_file_range_io_handle_seek_offset,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_exists,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_file_range_io_handle_is_open,
-	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_file_range_io_handle_get_size,
+	     &libbfio_file_range_io_operations,
 	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
 	     error ) != 1 )
 	{
@@ -105,6 +112,24 @@ int libbfio_file_range_initialize(
 
 		goto on_error;
 	}
+	if( libbfio_handle_set_access_hint_function(
+	     *handle,
+	     (int (*)(intptr_t *, int, off64_t, size64_t, libcerror_error_t **)) libbfio_file_range_io_handle_set_access_hint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint function.",
+		 function );
+
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+
+		return( -1 );
+	}
 	return( 1 );
 
 on_error:
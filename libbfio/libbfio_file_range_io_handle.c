@@ -105,6 +105,8 @@ int libbfio_file_range_io_handle_initialize(
 
 		goto on_error;
 	}
+	( *file_range_io_handle )->file_offset = -1;
+
 	return( 1 );
 
 on_error:
@@ -696,6 +698,9 @@ int libbfio_file_range_io_handle_open(
 
 		return( -1 );
 	}
+	file_range_io_handle->current_offset = 0;
+	file_range_io_handle->file_offset    = file_range_io_handle->range_offset;
+
 	return( 1 );
 }
 
@@ -732,6 +737,9 @@ int libbfio_file_range_io_handle_close(
 
 		return( -1 );
 	}
+	file_range_io_handle->current_offset = 0;
+	file_range_io_handle->file_offset    = -1;
+
 	return( 0 );
 }
 
@@ -759,44 +767,64 @@ ssize_t libbfio_file_range_io_handle_read_buffer(
 
 		return( -1 );
 	}
-	file_offset = libbfio_file_io_handle_seek_offset(
-	               file_range_io_handle->file_io_handle,
-	               0,
-	               SEEK_CUR,
-	               error );
-
-	if( file_offset == -1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current offset from file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_offset < file_range_io_handle->range_offset )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
 	if( file_range_io_handle->range_size != 0 )
 	{
-		if( (size64_t) file_offset >= file_range_io_handle->range_size )
+		if( (size64_t) file_range_io_handle->current_offset >= file_range_io_handle->range_size )
 		{
 			return( 0 );
 		}
-		if( (size64_t) ( file_offset + size ) >= file_range_io_handle->range_size )
+		if( (size64_t) size > ( file_range_io_handle->range_size - file_range_io_handle->current_offset ) )
+		{
+			size = (size_t) ( file_range_io_handle->range_size - file_range_io_handle->current_offset );
+		}
+	}
+	file_offset = file_range_io_handle->range_offset + file_range_io_handle->current_offset;
+
+	/* Only seek when the offset of the file IO handle differs from the offset in the range
+	 */
+	if( file_range_io_handle->file_offset != file_offset )
+	{
+		if( libbfio_file_io_handle_seek_offset(
+		     file_range_io_handle->file_io_handle,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
 		{
-			size = (size_t) ( file_range_io_handle->range_offset - file_offset );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in file IO handle.",
+			 function,
+			 file_offset );
+
+			file_range_io_handle->file_offset = -1;
+
+			return( -1 );
 		}
+		file_range_io_handle->file_offset = file_offset;
 	}
 	read_count = libbfio_file_io_handle_read_buffer(
 	              file_range_io_handle->file_io_handle,
@@ -813,8 +841,13 @@ ssize_t libbfio_file_range_io_handle_read_buffer(
 		 "%s: unable to read from file IO handle.",
 		 function );
 
+		file_range_io_handle->file_offset = -1;
+
 		return( -1 );
 	}
+	file_range_io_handle->current_offset += (off64_t) read_count;
+	file_range_io_handle->file_offset    += (off64_t) read_count;
+
 	return( read_count );
 }
 
@@ -842,45 +875,65 @@ ssize_t libbfio_file_range_io_handle_write_buffer(
 
 		return( -1 );
 	}
-	file_offset = libbfio_file_io_handle_seek_offset(
-	               file_range_io_handle->file_io_handle,
-	               0,
-	               SEEK_CUR,
-	               error );
-
-	if( file_offset == -1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current offset from file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_offset < file_range_io_handle->range_offset )
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
 	if( file_range_io_handle->range_size != 0 )
 	{
-		if( (size64_t) file_offset >= file_range_io_handle->range_size )
+		if( (size64_t) file_range_io_handle->current_offset >= file_range_io_handle->range_size )
 		{
 			return( 0 );
 		}
-		if( (size64_t) ( file_offset + size ) >= file_range_io_handle->range_size )
+		if( (size64_t) size > ( file_range_io_handle->range_size - file_range_io_handle->current_offset ) )
 		{
-			size = (size_t) ( file_range_io_handle->range_offset - file_offset );
+			size = (size_t) ( file_range_io_handle->range_size - file_range_io_handle->current_offset );
 		}
 	}
+	file_offset = file_range_io_handle->range_offset + file_range_io_handle->current_offset;
+
+	/* Only seek when the offset of the file IO handle differs from the offset in the range
+	 */
+	if( file_range_io_handle->file_offset != file_offset )
+	{
+		if( libbfio_file_io_handle_seek_offset(
+		     file_range_io_handle->file_io_handle,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " in file IO handle.",
+			 function,
+			 file_offset );
+
+			file_range_io_handle->file_offset = -1;
+
+			return( -1 );
+		}
+		file_range_io_handle->file_offset = file_offset;
+	}
 	write_count = libbfio_file_io_handle_write_buffer(
 	               file_range_io_handle->file_io_handle,
 	               buffer,
@@ -892,16 +945,22 @@ ssize_t libbfio_file_range_io_handle_write_buffer(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
 		 "%s: unable to write to file IO handle.",
 		 function );
 
+		file_range_io_handle->file_offset = -1;
+
 		return( -1 );
 	}
+	file_range_io_handle->current_offset += (off64_t) write_count;
+	file_range_io_handle->file_offset    += (off64_t) write_count;
+
 	return( write_count );
 }
 
 /* Seeks a certain offset within the file range IO handle
+ * The offset of the file IO handle is changed on the next read or write
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t libbfio_file_range_io_handle_seek_offset(
@@ -911,8 +970,8 @@ off64_t libbfio_file_range_io_handle_seek_offset(
          libcerror_error_t **error )
 {
 	static char *function = "libbfio_file_range_io_handle_seek_offset";
-	off64_t file_offset   = 0;
-	off64_t seek_offset   = 0;
+	size64_t file_size    = 0;
+	int result            = 0;
 
 	if( file_range_io_handle == NULL )
 	{
@@ -938,73 +997,62 @@ off64_t libbfio_file_range_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
+	result = libbfio_file_io_handle_is_open(
+	          file_range_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
 	{
-		file_offset = libbfio_file_io_handle_seek_offset(
-			       file_range_io_handle->file_io_handle,
-			       0,
-			       SEEK_CUR,
-			       error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if file is open.",
+		 function );
 
-		if( file_offset == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current offset from file IO handle.",
-			 function );
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file range IO handle - file IO handle not open.",
+		 function );
 
-			return( -1 );
-		}
-		offset += file_offset;
-		whence  = SEEK_SET;
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += file_range_io_handle->current_offset;
 	}
 	else if( whence == SEEK_END )
 	{
 		if( file_range_io_handle->range_size != 0 )
 		{
-			offset += file_range_io_handle->range_size;
-			whence  = SEEK_SET;
+			offset += (off64_t) file_range_io_handle->range_size;
 		}
-	}
-	else if( whence == SEEK_SET )
-	{
-		offset += file_range_io_handle->range_offset;
-	}
-	if( whence == SEEK_SET )
-	{
-		if( offset < file_range_io_handle->range_offset )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid offset value out of bounds.",
-			 function );
-
-			return( -1 );
+			if( libbfio_file_io_handle_get_size(
+			     file_range_io_handle->file_io_handle,
+			     &file_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size from file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+			offset += (off64_t) file_size - file_range_io_handle->range_offset;
 		}
 	}
-	seek_offset = libbfio_file_io_handle_seek_offset(
-	               file_range_io_handle->file_io_handle,
-	               offset,
-	               whence,
-	               error );
-
-	if( seek_offset == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: %" PRIi64 " in file IO handle.",
-		 function,
-		 offset );
-
-		return( -1 );
-	}
-	if( seek_offset < file_range_io_handle->range_offset )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1012,13 +1060,13 @@ off64_t libbfio_file_range_io_handle_seek_offset(
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
 		 "%s: invalid offset: %" PRIi64 " value out of bounds.",
 		 function,
-		 seek_offset );
+		 offset );
 
 		return( -1 );
 	}
-	seek_offset -= file_range_io_handle->range_offset;
+	file_range_io_handle->current_offset = offset;
 
-	return( seek_offset );
+	return( offset );
 }
 
 /* Function to determine if a file range exists
@@ -1156,3 +1204,90 @@ int libbfio_file_range_io_handle_get_size(
 	return( 1 );
 }
 
+/* Passes an access hint for the file range
+ * The offset and size of the will need and do not need access hints
+ * are relative to the start of the range, where a size of 0 represents
+ * the remainder of the range
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libbfio_file_range_io_handle_set_access_hint(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_file_range_io_handle_set_access_hint";
+	int result            = 0;
+
+	if( file_range_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file range IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_hint == LIBBFIO_ACCESS_HINT_WILLNEED )
+	 || ( access_hint == LIBBFIO_ACCESS_HINT_DONTNEED ) )
+	{
+		if( file_range_io_handle->range_size != 0 )
+		{
+			if( (size64_t) offset >= file_range_io_handle->range_size )
+			{
+				return( 1 );
+			}
+			if( ( size == 0 )
+			 || ( size > ( file_range_io_handle->range_size - (size64_t) offset ) ) )
+			{
+				size = file_range_io_handle->range_size - (size64_t) offset;
+			}
+		}
+		offset += file_range_io_handle->range_offset;
+	}
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_range_io_handle->file_io_handle,
+	          access_hint,
+	          offset,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint of file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
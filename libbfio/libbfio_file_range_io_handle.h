@@ -47,6 +47,15 @@ struct libbfio_file_range_io_handle
 	/* The range size
 	 */
 	size64_t range_size;
+
+	/* The current offset in the range
+	 */
+	off64_t current_offset;
+
+	/* The current offset of the file IO handle
+	 * or -1 if the offset is not known
+	 */
+	off64_t file_offset;
 };
 
 int libbfio_file_range_io_handle_initialize(
@@ -152,6 +161,13 @@ int libbfio_file_range_io_handle_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+int libbfio_file_range_io_handle_set_access_hint(
+     libbfio_file_range_io_handle_t *file_range_io_handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -27,12 +27,44 @@
 #include <unistd.h>
 #endif
 
+#include "libbfio_arena.h"
+#include "libbfio_atomic.h"
 #include "libbfio_definitions.h"
+#include "libbfio_descriptor_manager.h"
+#include "libbfio_extent.h"
 #include "libbfio_handle.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
+#include "libbfio_trace_recorder.h"
+#include "libbfio_unused.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && defined( HAVE_LIBBFIO_ATOMICS )
+#if defined( __GNUC__ )
+#define LIBBFIO_THREAD_LOCAL	__thread
+
+#elif defined( _MSC_VER )
+#define LIBBFIO_THREAD_LOCAL	__declspec( thread )
+
+#endif
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && defined( HAVE_LIBBFIO_ATOMICS ) */
+
+#if defined( LIBBFIO_THREAD_LOCAL )
+
+/* The last identifier of the offsets read stages of a handle
+ */
+static int64_t libbfio_handle_last_offsets_read_stages_identifier = 0;
+
+/* The identifier of the offsets read stages and the stage the thread last staged into
+ * The identifier prevents a stage of a freed handle from being reused
+ */
+static LIBBFIO_THREAD_LOCAL int64_t libbfio_handle_thread_offsets_read_stages_identifier = 0;
+
+static LIBBFIO_THREAD_LOCAL libbfio_offsets_read_stage_t *libbfio_handle_thread_offsets_read_stage = NULL;
+
+#endif /* defined( LIBBFIO_THREAD_LOCAL ) */
 
 /* Creates a handle
+ * The functions are stored in IO operations that are managed by the handle
  * Make sure the value handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -81,8 +113,8 @@ int libbfio_handle_initialize(
       uint8_t flags,
       libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_initialize";
+	libbfio_io_operations_t *io_operations = NULL;
+	static char *function                  = "libbfio_handle_initialize";
 
 	if( handle == NULL )
 	{
@@ -106,77 +138,207 @@ int libbfio_handle_initialize(
 
 		return( -1 );
 	}
-	internal_handle = memory_allocate_structure(
-	                   libbfio_internal_handle_t );
+	io_operations = memory_allocate_structure(
+	                 libbfio_io_operations_t );
 
-	if( internal_handle == NULL )
+	if( io_operations == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create handle.",
+		 "%s: unable to create IO operations.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     internal_handle,
-	     0,
-	     sizeof( libbfio_internal_handle_t ) ) == NULL )
+	io_operations->free_io_handle  = free_io_handle;
+	io_operations->clone_io_handle = clone_io_handle;
+	io_operations->open            = open;
+	io_operations->close           = close;
+	io_operations->read            = read;
+	io_operations->write           = write;
+	io_operations->seek_offset     = seek_offset;
+	io_operations->exists          = exists;
+	io_operations->is_open         = is_open;
+	io_operations->get_size        = get_size;
+
+	if( libbfio_handle_initialize_in_arena(
+	     handle,
+	     NULL,
+	     io_handle,
+	     io_operations,
+	     flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
 		 function );
 
 		memory_free(
-		 internal_handle );
+		 io_operations );
 
 		return( -1 );
 	}
-	if( libcdata_range_list_initialize(
-	     &( internal_handle->offsets_read ),
-	     error ) != 1 )
+	( (libbfio_internal_handle_t *) *handle )->managed_io_operations = io_operations;
+
+	return( 1 );
+}
+
+/* Creates a handle that uses the IO operations
+ * The IO operations are not managed by the handle and must remain
+ * available while the handle is in use, typically a single static table
+ * is shared by all the handles of the same type
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_initialize_with_operations(
+     libbfio_handle_t **handle,
+     intptr_t *io_handle,
+     const libbfio_io_operations_t *io_operations,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	return( libbfio_handle_initialize_in_arena(
+	         handle,
+	         NULL,
+	         io_handle,
+	         io_operations,
+	         flags,
+	         error ) );
+}
+
+/* Creates a handle that uses the IO operations
+ * If an arena is provided the handle is allocated from the arena
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_initialize_in_arena(
+     libbfio_handle_t **handle,
+     libbfio_arena_t *arena,
+     intptr_t *io_handle,
+     const libbfio_io_operations_t *io_operations,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_initialize_in_arena";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create read offsets list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_handle->read_write_lock ),
-	     error ) != 1 )
+	if( *handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to intialize read/write lock.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( io_operations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO operations.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena != NULL )
+	{
+		/* Memory allocated from an arena is cleared
+		 */
+		if( libbfio_arena_allocate(
+		     arena,
+		     sizeof( libbfio_internal_handle_t ),
+		     (uint8_t **) &internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create handle.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->is_arena_allocated = 1;
+	}
+	else
+	{
+		internal_handle = memory_allocate_structure(
+		                   libbfio_internal_handle_t );
+
+		if( internal_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_handle,
+		     0,
+		     sizeof( libbfio_internal_handle_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear handle.",
+			 function );
+
+			memory_free(
+			 internal_handle );
+
+			return( -1 );
+		}
+	}
+	/* The read offsets list is created when tracking offsets read is enabled
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( flags & LIBBFIO_FLAG_SINGLE_THREADED ) == 0 )
+	{
+		if( libbfio_lock_initialize_embedded(
+		     &( internal_handle->embedded_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to intialize read/write lock.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->read_write_lock = &( internal_handle->embedded_lock );
 	}
 #endif
-	internal_handle->io_handle       = io_handle;
-	internal_handle->flags           = flags;
-	internal_handle->free_io_handle  = free_io_handle;
-	internal_handle->clone_io_handle = clone_io_handle;
-	internal_handle->open            = open;
-	internal_handle->close           = close;
-	internal_handle->read            = read;
-	internal_handle->write           = write;
-	internal_handle->seek_offset     = seek_offset;
-	internal_handle->exists          = exists;
-	internal_handle->is_open         = is_open;
-	internal_handle->get_size        = get_size;
+	internal_handle->io_handle     = io_handle;
+	internal_handle->io_operations = io_operations;
+	internal_handle->flags         = flags;
 
 	*handle = (libbfio_handle_t *) internal_handle;
 
@@ -185,15 +347,11 @@ int libbfio_handle_initialize(
 on_error:
 	if( internal_handle != NULL )
 	{
-		if( internal_handle->offsets_read != NULL )
+		if( internal_handle->is_arena_allocated == 0 )
 		{
-			libcdata_range_list_free(
-			 &( internal_handle->offsets_read ),
-			 NULL,
-			 NULL );
+			memory_free(
+			 internal_handle );
 		}
-		memory_free(
-		 internal_handle );
 	}
 	return( -1 );
 }
@@ -206,6 +364,7 @@ int libbfio_handle_free(
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_offsets_read_stage_t *stage        = NULL;
 	static char *function                      = "libbfio_handle_free";
 	int is_open                                = 0;
 	int result                                 = 1;
@@ -226,9 +385,26 @@ int libbfio_handle_free(
 		internal_handle = (libbfio_internal_handle_t *) *handle;
 		*handle         = NULL;
 
-		if( internal_handle->is_open != NULL )
+		if( internal_handle->descriptor_manager != NULL )
+		{
+			if( libbfio_descriptor_manager_remove_handle(
+			     internal_handle->descriptor_manager,
+			     (libbfio_handle_t *) internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove handle from descriptor manager.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_handle->io_operations->is_open != NULL )
 		{
-			is_open = internal_handle->is_open(
+			is_open = internal_handle->io_operations->is_open(
 				   internal_handle->io_handle,
 			           error );
 
@@ -246,9 +422,9 @@ int libbfio_handle_free(
 		}
 		if( is_open != 0 )
 		{
-			if( internal_handle->close != NULL )
+			if( internal_handle->io_operations->close != NULL )
 			{
-				if( internal_handle->close(
+				if( internal_handle->io_operations->close(
 				     internal_handle->io_handle,
 				     error ) != 0 )
 				{
@@ -264,30 +440,34 @@ int libbfio_handle_free(
 			}
 		}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-		if( libcthreads_read_write_lock_free(
-		     &( internal_handle->read_write_lock ),
-		     error ) != 1 )
+		if( internal_handle->read_write_lock != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free read/write lock.",
-			 function );
+			if( libbfio_lock_finalize_embedded(
+			     internal_handle->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read/write lock.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
+			internal_handle->read_write_lock = NULL;
 		}
 #endif
 		if( ( internal_handle->flags & LIBBFIO_FLAG_IO_HANDLE_MANAGED ) != 0 )
 		{
 			if( internal_handle->io_handle != NULL )
 			{
-				if( internal_handle->free_io_handle == NULL )
+				if( internal_handle->io_operations->free_io_handle == NULL )
 				{
 					memory_free(
 					 internal_handle->io_handle );
 				}
-				else if( internal_handle->free_io_handle(
+				else if( internal_handle->io_operations->free_io_handle(
 					  &( internal_handle->io_handle ),
 					  error ) != 1 )
 				{
@@ -319,8 +499,78 @@ int libbfio_handle_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 internal_handle );
+		if( internal_handle->offsets_read_counts != NULL )
+		{
+			memory_free(
+			 internal_handle->offsets_read_counts );
+		}
+		while( internal_handle->offsets_read_stages != NULL )
+		{
+			stage                                = internal_handle->offsets_read_stages;
+			internal_handle->offsets_read_stages = stage->next_stage;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+			if( libcthreads_mutex_free(
+			     &( stage->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free offsets read stage mutex.",
+				 function );
+
+				result = -1;
+			}
+#endif
+			memory_free(
+			 stage );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_free(
+		     &( internal_handle->offsets_read_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offsets read mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_handle->extents != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_handle->extents ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extents array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_handle->managed_io_operations != NULL )
+		{
+			memory_free(
+			 internal_handle->managed_io_operations );
+		}
+		/* Memory allocated from an arena is freed with the arena
+		 */
+		if( internal_handle->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 internal_handle );
+		}
 	}
 	return( result );
 }
@@ -338,6 +588,7 @@ int libbfio_handle_clone(
 	intptr_t *destination_io_handle                   = NULL;
 	static char *function                             = "libbfio_handle_clone";
 	uint8_t destination_flags                         = 0;
+	int result                                        = 0;
 
 	if( destination_handle == NULL )
 	{
@@ -370,9 +621,10 @@ int libbfio_handle_clone(
 	internal_source_handle = (libbfio_internal_handle_t *) source_handle;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_source_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_source_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_source_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -394,7 +646,7 @@ int libbfio_handle_clone(
 		}
 		else
 		{
-			if( internal_source_handle->clone_io_handle == NULL )
+			if( internal_source_handle->io_operations->clone_io_handle == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -405,7 +657,7 @@ int libbfio_handle_clone(
 
 				goto on_error;
 			}
-			if( internal_source_handle->clone_io_handle(
+			if( internal_source_handle->io_operations->clone_io_handle(
 			     &destination_io_handle,
 			     internal_source_handle->io_handle,
 			     error ) != 1 )
@@ -422,21 +674,36 @@ int libbfio_handle_clone(
 			destination_flags = LIBBFIO_FLAG_IO_HANDLE_MANAGED;
 		}
 	}
-	if( libbfio_handle_initialize(
-	     destination_handle,
-	     destination_io_handle,
-	     internal_source_handle->free_io_handle,
-	     internal_source_handle->clone_io_handle,
-	     internal_source_handle->open,
-	     internal_source_handle->close,
-	     internal_source_handle->read,
-	     internal_source_handle->write,
-	     internal_source_handle->seek_offset,
-	     internal_source_handle->exists,
-	     internal_source_handle->is_open,
-	     internal_source_handle->get_size,
-	     destination_flags,
-	     error ) != 1 )
+	/* IO operations that are managed by the source handle cannot be shared
+	 */
+	if( internal_source_handle->managed_io_operations != NULL )
+	{
+		result = libbfio_handle_initialize(
+		          destination_handle,
+		          destination_io_handle,
+		          internal_source_handle->io_operations->free_io_handle,
+		          internal_source_handle->io_operations->clone_io_handle,
+		          internal_source_handle->io_operations->open,
+		          internal_source_handle->io_operations->close,
+		          internal_source_handle->io_operations->read,
+		          internal_source_handle->io_operations->write,
+		          internal_source_handle->io_operations->seek_offset,
+		          internal_source_handle->io_operations->exists,
+		          internal_source_handle->io_operations->is_open,
+		          internal_source_handle->io_operations->get_size,
+		          destination_flags,
+		          error );
+	}
+	else
+	{
+		result = libbfio_handle_initialize_with_operations(
+		          destination_handle,
+		          destination_io_handle,
+		          internal_source_handle->io_operations,
+		          destination_flags,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -449,6 +716,12 @@ int libbfio_handle_clone(
 	}
 	destination_io_handle = NULL;
 
+	( (libbfio_internal_handle_t *) *destination_handle )->get_extents     = internal_source_handle->get_extents;
+	( (libbfio_internal_handle_t *) *destination_handle )->set_access_hint = internal_source_handle->set_access_hint;
+	( (libbfio_internal_handle_t *) *destination_handle )->read_at_offset  = internal_source_handle->read_at_offset;
+	( (libbfio_internal_handle_t *) *destination_handle )->sparse_read     = internal_source_handle->sparse_read;
+	( (libbfio_internal_handle_t *) *destination_handle )->error_mode      = internal_source_handle->error_mode;
+
 	if( internal_source_handle->access_flags != 0 )
 	{
 		if( libbfio_handle_open(
@@ -482,9 +755,10 @@ int libbfio_handle_clone(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_source_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_source_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_source_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -506,14 +780,14 @@ on_error:
 	if( ( destination_io_handle != NULL )
 	 && ( ( destination_flags & LIBBFIO_FLAG_IO_HANDLE_MANAGED ) != 0 ) )
 	{
-		if( internal_source_handle->free_io_handle == NULL )
+		if( internal_source_handle->io_operations->free_io_handle == NULL )
 		{
 			memory_free(
 			 destination_io_handle );
 		}
 		else
 		{
-			internal_source_handle->free_io_handle(
+			internal_source_handle->io_operations->free_io_handle(
 			 &destination_io_handle,
 			 NULL );
 		}
@@ -525,71 +799,338 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_source_handle->read_write_lock,
-	 NULL );
+	if( internal_source_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_source_handle->read_write_lock,
+		 NULL );
+	}
 #endif
 	return( -1 );
 }
 
-/* Opens the handle
+/* Opens the IO handle and calls the trace callbacks if set
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_open(
-     libbfio_handle_t *handle,
+int libbfio_internal_handle_io_open(
+     libbfio_internal_handle_t *internal_handle,
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_open";
+	uint64_t start_timestamp = 0;
+	int result               = 0;
 
-	if( handle == NULL )
+	if( internal_handle->trace.is_enabled == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
-
-		return( -1 );
+		return( internal_handle->io_operations->open(
+		         internal_handle->io_handle,
+		         access_flags,
+		         error ) );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	start_timestamp = libbfio_trace_begin(
+	                   &( internal_handle->trace ),
+	                   LIBBFIO_TRACE_OPERATION_OPEN,
+	                   -1,
+	                   0,
+	                   0 );
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
+	result = internal_handle->io_operations->open(
+	          internal_handle->io_handle,
+	          access_flags,
+	          error );
 
-		return( -1 );
-	}
-	if( internal_handle->open == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing open function.",
-		 function );
+	libbfio_trace_end(
+	 &( internal_handle->trace ),
+	 LIBBFIO_TRACE_OPERATION_OPEN,
+	 -1,
+	 0,
+	 0,
+	 (int64_t) result,
+	 start_timestamp );
 
-		return( -1 );
-	}
-	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags: 0x%02x.",
-		 function,
-		 access_flags );
+	return( result );
+}
 
-		return( -1 );
+/* Closes the IO handle and calls the trace callbacks if set
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_internal_handle_io_close(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	uint64_t start_timestamp = 0;
+	int result               = 0;
+
+	if( internal_handle->trace.is_enabled == 0 )
+	{
+		return( internal_handle->io_operations->close(
+		         internal_handle->io_handle,
+		         error ) );
+	}
+	start_timestamp = libbfio_trace_begin(
+	                   &( internal_handle->trace ),
+	                   LIBBFIO_TRACE_OPERATION_CLOSE,
+	                   -1,
+	                   0,
+	                   0 );
+
+	result = internal_handle->io_operations->close(
+	          internal_handle->io_handle,
+	          error );
+
+	libbfio_trace_end(
+	 &( internal_handle->trace ),
+	 LIBBFIO_TRACE_OPERATION_CLOSE,
+	 -1,
+	 0,
+	 0,
+	 (int64_t) result,
+	 start_timestamp );
+
+	return( result );
+}
+
+/* Reads a buffer from the IO handle and calls the trace callbacks if set
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbfio_internal_handle_io_read(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint64_t start_timestamp = 0;
+	ssize_t read_count       = 0;
+
+	if( internal_handle->trace.is_enabled == 0 )
+	{
+		return( internal_handle->io_operations->read(
+		         internal_handle->io_handle,
+		         buffer,
+		         size,
+		         error ) );
+	}
+	start_timestamp = libbfio_trace_begin(
+	                   &( internal_handle->trace ),
+	                   LIBBFIO_TRACE_OPERATION_READ,
+	                   -1,
+	                   internal_handle->current_offset,
+	                   (size64_t) size );
+
+	read_count = internal_handle->io_operations->read(
+	              internal_handle->io_handle,
+	              buffer,
+	              size,
+	              error );
+
+	libbfio_trace_end(
+	 &( internal_handle->trace ),
+	 LIBBFIO_TRACE_OPERATION_READ,
+	 -1,
+	 internal_handle->current_offset,
+	 (size64_t) size,
+	 (int64_t) read_count,
+	 start_timestamp );
+
+	return( read_count );
+}
+
+/* Reads a buffer from the IO handle at a specific offset and calls the trace callbacks if set
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libbfio_internal_handle_io_read_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint64_t start_timestamp = 0;
+	ssize_t read_count       = 0;
+
+	if( internal_handle->trace.is_enabled == 0 )
+	{
+		return( internal_handle->read_at_offset(
+		         internal_handle->io_handle,
+		         buffer,
+		         size,
+		         offset,
+		         error ) );
+	}
+	start_timestamp = libbfio_trace_begin(
+	                   &( internal_handle->trace ),
+	                   LIBBFIO_TRACE_OPERATION_READ,
+	                   -1,
+	                   offset,
+	                   (size64_t) size );
+
+	read_count = internal_handle->read_at_offset(
+	              internal_handle->io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	libbfio_trace_end(
+	 &( internal_handle->trace ),
+	 LIBBFIO_TRACE_OPERATION_READ,
+	 -1,
+	 offset,
+	 (size64_t) size,
+	 (int64_t) read_count,
+	 start_timestamp );
+
+	return( read_count );
+}
+
+/* Writes a buffer to the IO handle and calls the trace callbacks if set
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libbfio_internal_handle_io_write(
+         libbfio_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	uint64_t start_timestamp = 0;
+	ssize_t write_count      = 0;
+
+	if( internal_handle->trace.is_enabled == 0 )
+	{
+		return( internal_handle->io_operations->write(
+		         internal_handle->io_handle,
+		         buffer,
+		         size,
+		         error ) );
+	}
+	start_timestamp = libbfio_trace_begin(
+	                   &( internal_handle->trace ),
+	                   LIBBFIO_TRACE_OPERATION_WRITE,
+	                   -1,
+	                   internal_handle->current_offset,
+	                   (size64_t) size );
+
+	write_count = internal_handle->io_operations->write(
+	               internal_handle->io_handle,
+	               buffer,
+	               size,
+	               error );
+
+	libbfio_trace_end(
+	 &( internal_handle->trace ),
+	 LIBBFIO_TRACE_OPERATION_WRITE,
+	 -1,
+	 internal_handle->current_offset,
+	 (size64_t) size,
+	 (int64_t) write_count,
+	 start_timestamp );
+
+	return( write_count );
+}
+
+/* Seeks an offset in the IO handle and calls the trace callbacks if set
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_internal_handle_io_seek_offset(
+         libbfio_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	uint64_t start_timestamp = 0;
+	off64_t result_offset    = 0;
+
+	if( internal_handle->trace.is_enabled == 0 )
+	{
+		return( internal_handle->io_operations->seek_offset(
+		         internal_handle->io_handle,
+		         offset,
+		         whence,
+		         error ) );
+	}
+	start_timestamp = libbfio_trace_begin(
+	                   &( internal_handle->trace ),
+	                   LIBBFIO_TRACE_OPERATION_SEEK,
+	                   -1,
+	                   offset,
+	                   0 );
+
+	result_offset = internal_handle->io_operations->seek_offset(
+	                 internal_handle->io_handle,
+	                 offset,
+	                 whence,
+	                 error );
+
+	libbfio_trace_end(
+	 &( internal_handle->trace ),
+	 LIBBFIO_TRACE_OPERATION_SEEK,
+	 -1,
+	 offset,
+	 0,
+	 (int64_t) result_offset,
+	 start_timestamp );
+
+	return( result_offset );
+}
+
+/* Opens the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_open(
+     libbfio_handle_t *handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_open";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_operations->open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing open function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
 	}
 	if( ( internal_handle->open_on_demand != 0 )
 	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 ) )
@@ -604,9 +1145,10 @@ int libbfio_handle_open(
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -620,8 +1162,8 @@ int libbfio_handle_open(
 #endif
 	if( internal_handle->open_on_demand == 0 )
 	{
-		if( internal_handle->open(
-		     internal_handle->io_handle,
+		if( libbfio_internal_handle_io_open(
+		     internal_handle,
 		     access_flags,
 		     error ) != 1 )
 		{
@@ -635,12 +1177,15 @@ int libbfio_handle_open(
 			goto on_error;
 		}
 	}
-	internal_handle->access_flags = access_flags;
+	libbfio_atomic_store_int32(
+	 &( internal_handle->access_flags ),
+	 access_flags );
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -656,9 +1201,12 @@ int libbfio_handle_open(
 
 on_error:
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
 #endif
 	return( -1 );
 }
@@ -698,7 +1246,7 @@ int libbfio_handle_reopen(
 
 		return( -1 );
 	}
-	if( internal_handle->close == NULL )
+	if( internal_handle->io_operations->close == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -709,7 +1257,7 @@ int libbfio_handle_reopen(
 
 		return( -1 );
 	}
-	if( internal_handle->open == NULL )
+	if( internal_handle->io_operations->open == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -720,7 +1268,7 @@ int libbfio_handle_reopen(
 
 		return( -1 );
 	}
-	if( internal_handle->seek_offset == NULL )
+	if( internal_handle->io_operations->seek_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -744,9 +1292,10 @@ int libbfio_handle_reopen(
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -762,8 +1311,8 @@ int libbfio_handle_reopen(
 	 */
 	if( internal_handle->access_flags != access_flags )
 	{
-		if( internal_handle->close(
-		     internal_handle->io_handle,
+		if( libbfio_internal_handle_io_close(
+		     internal_handle,
 		     error ) != 0 )
 		{
 			libcerror_error_set(
@@ -777,8 +1326,8 @@ int libbfio_handle_reopen(
 		}
 		if( internal_handle->open_on_demand == 0 )
 		{
-			if( internal_handle->open(
-			     internal_handle->io_handle,
+			if( libbfio_internal_handle_io_open(
+			     internal_handle,
 			     access_flags,
 			     error ) != 1 )
 			{
@@ -792,7 +1341,9 @@ int libbfio_handle_reopen(
 				goto on_error;
 			}
 		}
-		internal_handle->access_flags = access_flags;
+		libbfio_atomic_store_int32(
+		 &( internal_handle->access_flags ),
+		 access_flags );
 
 		if( internal_handle->open_on_demand == 0 )
 		{
@@ -800,8 +1351,8 @@ int libbfio_handle_reopen(
 			 */
 			if( ( internal_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) != 0 )
 			{
-				if( internal_handle->seek_offset(
-				     internal_handle->io_handle,
+				if( libbfio_internal_handle_io_seek_offset(
+				     internal_handle,
 				     internal_handle->current_offset,
 				     SEEK_CUR,
 				     error ) == -1 )
@@ -819,9 +1370,10 @@ int libbfio_handle_reopen(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -837,9 +1389,12 @@ int libbfio_handle_reopen(
 
 on_error:
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
 #endif
 	return( -1 );
 }
@@ -853,7 +1408,6 @@ int libbfio_handle_close(
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
 	static char *function                      = "libbfio_handle_close";
-	int is_open                                = 1;
 
 	if( handle == NULL )
 	{
@@ -868,6 +1422,64 @@ int libbfio_handle_close(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
+	/* The handle is removed from the descriptor manager before the read/write lock
+	 * of the handle is grabbed, since the descriptor manager closes handles while
+	 * holding its own read/write lock
+	 */
+	if( internal_handle->descriptor_manager != NULL )
+	{
+		if( libbfio_descriptor_manager_remove_handle(
+		     internal_handle->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_internal_handle_close(
+	     internal_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Closes the handle without removing it from the descriptor manager
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_internal_handle_close(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_close";
+	int is_open           = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -879,7 +1491,7 @@ int libbfio_handle_close(
 
 		return( -1 );
 	}
-	if( internal_handle->close == NULL )
+	if( internal_handle->io_operations->close == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -891,9 +1503,10 @@ int libbfio_handle_close(
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -907,7 +1520,7 @@ int libbfio_handle_close(
 #endif
 	if( internal_handle->open_on_demand != 0 )
 	{
-		if( internal_handle->is_open == NULL )
+		if( internal_handle->io_operations->is_open == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -918,7 +1531,7 @@ int libbfio_handle_close(
 
 			goto on_error;
 		}
-		is_open = internal_handle->is_open(
+		is_open = internal_handle->io_operations->is_open(
 			   internal_handle->io_handle,
 		           error );
 
@@ -936,8 +1549,8 @@ int libbfio_handle_close(
 	}
 	if( is_open != 0 )
 	{
-		if( internal_handle->close(
-		     internal_handle->io_handle,
+		if( libbfio_internal_handle_io_close(
+		     internal_handle,
 		     error ) != 0 )
 		{
 			libcerror_error_set(
@@ -950,10 +1563,29 @@ int libbfio_handle_close(
 			goto on_error;
 		}
 	}
+	if( internal_handle->extents != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_handle->extents ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extents array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_handle->io_handle_offset_is_stale = 0;
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -969,27 +1601,26 @@ int libbfio_handle_close(
 
 on_error:
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
 #endif
 	return( -1 );
 }
 
-/* Reads data at the current offset into the buffer
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes read if successful, or -1 on error
+/* Closes the handle, if open, without removing it from the descriptor manager
+ * The open check and the close are done while holding the read/write lock of the handle
+ * Returns 1 if the handle was closed, 0 if the handle was not open or -1 on error
  */
-ssize_t libbfio_internal_handle_read_buffer(
-         libbfio_internal_handle_t *internal_handle,
-         uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_internal_handle_close_if_open(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
 {
-	static char *function = "libbfio_internal_handle_read_buffer";
-	ssize_t read_count    = 0;
+	static char *function = "libbfio_internal_handle_close_if_open";
 	int is_open           = 0;
-	int result            = 0;
 
 	if( internal_handle == NULL )
 	{
@@ -1002,207 +1633,4456 @@ ssize_t libbfio_internal_handle_read_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->read == NULL )
+	if( internal_handle->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing read function.",
+		 "%s: invalid handle - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( internal_handle->io_operations->is_open == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing is open function.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->open_on_demand != 0 )
-	{
-		if( internal_handle->is_open == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing is open function.",
-			 function );
+#endif
+	is_open = internal_handle->io_operations->is_open(
+	           internal_handle->io_handle,
+	           error );
 
-			return( -1 );
-		}
-		if( internal_handle->open == NULL )
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_open != 0 )
+	{
+		if( libbfio_internal_handle_io_close(
+		     internal_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_handle->extents != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_handle->extents ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free extents array.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_handle->io_handle_offset_is_stale = 0;
+
+		/* Make sure the truncate flag is removed from the handle
+		 */
+		libbfio_atomic_store_int32(
+		 &( internal_handle->access_flags ),
+		 internal_handle->access_flags & ~( LIBBFIO_ACCESS_FLAG_TRUNCATE ) );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( is_open );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Applies an offset range read to the offsets read list and read counts
+ * In the blocks tracking mode only the read counts are tracked
+ * This function is not multi-thread safe acquire the offsets read mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_apply_offset_read(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	uint32_t *offsets_read_counts        = NULL;
+	static char *function                = "libbfio_internal_handle_apply_offset_read";
+	size64_t handle_size                 = 0;
+	size_t block_index                   = 0;
+	size_t last_block_index              = 0;
+	size_t number_of_offsets_read_counts = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->offsets_read_tracking_mode == LIBBFIO_OFFSETS_READ_TRACKING_MODE_RANGES )
+	 && ( internal_handle->offsets_read != NULL ) )
+	{
+		if( libcdata_range_list_insert_range(
+		     internal_handle->offsets_read,
+		     (uint64_t) offset,
+		     (uint64_t) size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing open function.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert offset range to offsets read table.",
 			 function );
 
 			return( -1 );
 		}
-		if( internal_handle->seek_offset == NULL )
+	}
+	if( internal_handle->offsets_read_block_size == 0 )
+	{
+		return( 1 );
+	}
+	block_index      = (size_t) ( (size64_t) offset / internal_handle->offsets_read_block_size );
+	last_block_index = (size_t) ( ( (size64_t) offset + size - 1 ) / internal_handle->offsets_read_block_size );
+
+	if( last_block_index >= internal_handle->number_of_offsets_read_counts )
+	{
+		/* Grow the read counts at least twofold to keep the number of reallocations low
+		 */
+		number_of_offsets_read_counts = internal_handle->number_of_offsets_read_counts * 2;
+
+		/* The read counts are sized to the size of the handle when it is known,
+		 * the size is not retrieved here since the read/write lock is not held
+		 */
+		if( ( internal_handle->offsets_read_counts == NULL )
+		 && ( libbfio_atomic_load_uint8(
+		       &( internal_handle->size_set ) ) != 0 ) )
+		{
+			handle_size = (size64_t) libbfio_atomic_load_int64(
+			                          &( internal_handle->size ) );
+
+			number_of_offsets_read_counts = (size_t) ( ( handle_size + internal_handle->offsets_read_block_size - 1 ) / internal_handle->offsets_read_block_size );
+		}
+		if( number_of_offsets_read_counts <= last_block_index )
+		{
+			number_of_offsets_read_counts = last_block_index + 1;
+		}
+		if( number_of_offsets_read_counts > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing seek offset function.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of offsets read counts value exceeds maximum.",
 			 function );
 
 			return( -1 );
 		}
-		is_open = internal_handle->is_open(
-			   internal_handle->io_handle,
-		           error );
+		offsets_read_counts = (uint32_t *) memory_reallocate(
+		                                    internal_handle->offsets_read_counts,
+		                                    sizeof( uint32_t ) * number_of_offsets_read_counts );
 
-		if( is_open == -1 )
+		if( offsets_read_counts == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to determine if handle is open.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize offsets read counts.",
 			 function );
 
 			return( -1 );
 		}
-		else if( is_open == 0 )
-		{
-			if( internal_handle->open(
-			     internal_handle->io_handle,
-			     internal_handle->access_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_OPEN_FAILED,
-				 "%s: unable to open handle on demand.",
-				 function );
+		internal_handle->offsets_read_counts = offsets_read_counts;
 
-				return( -1 );
-			}
-			if( internal_handle->seek_offset(
-			     internal_handle->io_handle,
-			     internal_handle->current_offset,
-			     SEEK_SET,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 "%s: unable to seek current offset: %" PRIi64 " in handle.",
-				 function,
-				 internal_handle->current_offset );
+		if( memory_set(
+		     &( offsets_read_counts[ internal_handle->number_of_offsets_read_counts ] ),
+		     0,
+		     sizeof( uint32_t ) * ( number_of_offsets_read_counts - internal_handle->number_of_offsets_read_counts ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear offsets read counts.",
+			 function );
 
-				return( -1 );
-			}
+			return( -1 );
 		}
+		internal_handle->number_of_offsets_read_counts = number_of_offsets_read_counts;
 	}
-	read_count = internal_handle->read(
-	              internal_handle->io_handle,
-	              buffer,
-	              size,
-	              error );
+	while( block_index <= last_block_index )
+	{
+		/* The read count saturates instead of wrapping around
+		 */
+		if( internal_handle->offsets_read_counts[ block_index ] < (uint32_t) UINT32_MAX )
+		{
+			internal_handle->offsets_read_counts[ block_index ] += 1;
+		}
+		block_index++;
+	}
+	return( 1 );
+}
 
-	if( read_count < 0 )
+/* Merges the staged offset ranges read of all stages into the offsets read list and read counts
+ * This function is not multi-thread safe acquire the offsets read mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_merge_staged_offsets_read(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libbfio_offsets_read_stage_t *stage = NULL;
+	static char *function               = "libbfio_internal_handle_merge_staged_offsets_read";
+	int result                          = 1;
+	int staged_offset_index             = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->track_offsets_read != 0 )
+	for( stage = internal_handle->offsets_read_stages;
+	     stage != NULL;
+	     stage = stage->next_stage )
 	{
-		result = libcdata_range_list_insert_range(
-		          internal_handle->offsets_read,
-		          (uint64_t) internal_handle->current_offset,
-		          (uint64_t) read_count,
-		          NULL,
-		          NULL,
-		          NULL,
-		          error );
-
-		if( result == -1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_grab(
+		     stage->mutex,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert offset range to offsets read table.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab offsets read stage mutex.",
 			 function );
 
 			return( -1 );
 		}
-	}
-	internal_handle->current_offset += (off64_t) read_count;
+#endif
+		for( staged_offset_index = 0;
+		     staged_offset_index < stage->number_of_offsets_read;
+		     staged_offset_index++ )
+		{
+			if( libbfio_internal_handle_apply_offset_read(
+			     internal_handle,
+			     stage->offsets_read[ staged_offset_index ].offset,
+			     stage->offsets_read[ staged_offset_index ].size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to apply staged offset range read: %d.",
+				 function,
+				 staged_offset_index );
 
-	if( internal_handle->open_on_demand != 0 )
-	{
-		if( internal_handle->close == NULL )
+				result = -1;
+
+				break;
+			}
+		}
+		stage->number_of_offsets_read = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_release(
+		     stage->mutex,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing close function.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release offsets read stage mutex.",
 			 function );
 
 			return( -1 );
 		}
-		if( internal_handle->close(
-		     internal_handle->io_handle,
-		     error ) != 0 )
+#endif
+		if( result != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to close handle on demand.",
-			 function );
-
-			return( -1 );
+			break;
 		}
 	}
-	return( read_count );
+	return( result );
 }
 
-/* Reads data at the current offset into the buffer
- * Returns the number of bytes read if successful, or -1 on error
+/* Retrieves the offsets read stage of the calling thread
+ * The stage is created if it does not exist, when thread local storage is not
+ * available a single stage is shared by all threads
+ * This function does not require the read/write lock, it grabs the offsets read mutex
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_read_buffer(
-         libbfio_handle_t *handle,
-         uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_internal_handle_get_offsets_read_stage(
+     libbfio_internal_handle_t *internal_handle,
+     libbfio_offsets_read_stage_t **stage,
+     libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_read_buffer";
-	ssize_t read_count                         = 0;
+	libbfio_offsets_read_stage_t *safe_stage = NULL;
+	intptr_t *owner                          = NULL;
+	static char *function                    = "libbfio_internal_handle_get_offsets_read_stage";
+	int result                               = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBBFIO_THREAD_LOCAL )
+	/* The stage the thread last staged into is reused without grabbing the offsets read mutex
+	 */
+	if( ( libbfio_handle_thread_offsets_read_stage != NULL )
+	 && ( libbfio_handle_thread_offsets_read_stages_identifier == internal_handle->offsets_read_stages_identifier ) )
+	{
+		*stage = libbfio_handle_thread_offsets_read_stage;
+
+		return( 1 );
+	}
+	/* The address of a thread local variable uniquely identifies the thread
+	 */
+	owner = (intptr_t *) &libbfio_handle_thread_offsets_read_stage;
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_handle->offsets_read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( safe_stage = internal_handle->offsets_read_stages;
+	     safe_stage != NULL;
+	     safe_stage = safe_stage->next_stage )
+	{
+		if( safe_stage->owner == owner )
+		{
+			break;
+		}
+	}
+	if( safe_stage == NULL )
+	{
+		safe_stage = memory_allocate_structure(
+		              libbfio_offsets_read_stage_t );
+
+		if( safe_stage == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create offsets read stage.",
+			 function );
+
+			result = -1;
+		}
+		else if( memory_set(
+		          safe_stage,
+		          0,
+		          sizeof( libbfio_offsets_read_stage_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear offsets read stage.",
+			 function );
+
+			memory_free(
+			 safe_stage );
+
+			safe_stage = NULL;
+			result     = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		else if( libcthreads_mutex_initialize(
+		          &( safe_stage->mutex ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize offsets read stage mutex.",
+			 function );
+
+			memory_free(
+			 safe_stage );
+
+			safe_stage = NULL;
+			result     = -1;
+		}
+#endif
+		else
+		{
+			safe_stage->owner      = owner;
+			safe_stage->next_stage = internal_handle->offsets_read_stages;
+
+			internal_handle->offsets_read_stages = safe_stage;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_handle->offsets_read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+#if defined( LIBBFIO_THREAD_LOCAL )
+	libbfio_handle_thread_offsets_read_stages_identifier = internal_handle->offsets_read_stages_identifier;
+	libbfio_handle_thread_offsets_read_stage             = safe_stage;
+#endif
+	*stage = safe_stage;
+
+	return( 1 );
+}
+
+/* Tracks an offset range that was read
+ * The offset range is staged in the stage of the calling thread, the stages are merged
+ * into the offsets read list and read counts when a stage is full or when the offsets
+ * read are retrieved, hence a tracked read normally does not allocate memory
+ * This function does not require the read/write lock, it grabs the offsets read mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_track_offset_read(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libbfio_offsets_read_stage_t *stage = NULL;
+	static char *function               = "libbfio_internal_handle_track_offset_read";
+	size64_t block_size                 = 0;
+	uint32_t sample_counter             = 0;
+	uint32_t sampling_interval          = 0;
+	int result                          = 1;
+	int staged_offset_index             = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( libbfio_internal_handle_get_offsets_read_stage(
+	     internal_handle,
+	     &stage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offsets read stage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     stage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read stage mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	sampling_interval = (uint32_t) libbfio_atomic_load_int32(
+	                                &( internal_handle->offsets_read_sampling_interval ) );
+
+	if( sampling_interval > 1 )
+	{
+		/* Only the first read of every sampling interval is tracked
+		 */
+		sample_counter = stage->sample_counter;
+
+		stage->sample_counter += 1;
+
+		if( stage->sample_counter >= sampling_interval )
+		{
+			stage->sample_counter = 0;
+		}
+	}
+	if( sample_counter == 0 )
+	{
+		block_size = (size64_t) libbfio_atomic_load_int64(
+		                         &( internal_handle->offsets_read_block_size ) );
+
+		staged_offset_index = stage->number_of_offsets_read - 1;
+
+		/* Consecutive reads are combined into a single staged offset range,
+		 * unless the read counts are tracked, which count every read
+		 */
+		if( ( block_size == 0 )
+		 && ( staged_offset_index >= 0 )
+		 && ( ( stage->offsets_read[ staged_offset_index ].offset + (off64_t) stage->offsets_read[ staged_offset_index ].size ) == offset ) )
+		{
+			stage->offsets_read[ staged_offset_index ].size += size;
+		}
+		else
+		{
+			while( stage->number_of_offsets_read >= LIBBFIO_HANDLE_NUMBER_OF_STAGED_OFFSETS_READ )
+			{
+				/* The stage mutex is released since the merge grabs it after the offsets read mutex
+				 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+				if( libcthreads_mutex_release(
+				     stage->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release offsets read stage mutex.",
+					 function );
+
+					return( -1 );
+				}
+				if( libcthreads_mutex_grab(
+				     internal_handle->offsets_read_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to grab offsets read mutex.",
+					 function );
+
+					return( -1 );
+				}
+#endif
+				result = libbfio_internal_handle_merge_staged_offsets_read(
+				          internal_handle,
+				          error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to merge staged offsets read.",
+					 function );
+				}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+				if( libcthreads_mutex_release(
+				     internal_handle->offsets_read_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release offsets read mutex.",
+					 function );
+
+					return( -1 );
+				}
+#endif
+				if( result != 1 )
+				{
+					return( -1 );
+				}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+				if( libcthreads_mutex_grab(
+				     stage->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to grab offsets read stage mutex.",
+					 function );
+
+					return( -1 );
+				}
+#endif
+			}
+			staged_offset_index = stage->number_of_offsets_read;
+
+			stage->offsets_read[ staged_offset_index ].offset = offset;
+			stage->offsets_read[ staged_offset_index ].size   = size;
+
+			stage->number_of_offsets_read += 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     stage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read stage mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads data at the current offset into the buffer
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_read_buffer(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_read_buffer";
+	size64_t extent_size  = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t extent_offset = 0;
+	uint32_t extent_flags = 0;
+	int is_open           = 0;
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_operations->read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( internal_handle->io_operations->is_open == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing is open function.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->io_operations->open == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing open function.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->io_operations->seek_offset == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing seek offset function.",
+			 function );
+
+			return( -1 );
+		}
+		is_open = internal_handle->io_operations->is_open(
+			   internal_handle->io_handle,
+		           error );
+
+		if( is_open == -1 )
+		{
+			internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+			internal_handle->last_error_code   = LIBCERROR_IO_ERROR_OPEN_FAILED;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if handle is open.",
+			 function );
+
+			return( -1 );
+		}
+		else if( is_open == 0 )
+		{
+			if( libbfio_internal_handle_io_open(
+			     internal_handle,
+			     internal_handle->access_flags,
+			     error ) != 1 )
+			{
+				internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+				internal_handle->last_error_code   = LIBCERROR_IO_ERROR_OPEN_FAILED;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open handle on demand.",
+				 function );
+
+				return( -1 );
+			}
+			if( libbfio_internal_handle_io_seek_offset(
+			     internal_handle,
+			     internal_handle->current_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+				internal_handle->last_error_code   = LIBCERROR_IO_ERROR_SEEK_FAILED;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek current offset: %" PRIi64 " in handle.",
+				 function,
+				 internal_handle->current_offset );
+
+				return( -1 );
+			}
+			internal_handle->io_handle_offset_is_stale = 0;
+		}
+	}
+	/* In sparse read mode the read is split at the boundaries of the extents
+	 * so that holes can be filled with zero bytes
+	 */
+	while( buffer_offset < size )
+	{
+		read_size    = size - buffer_offset;
+		extent_flags = 0;
+
+		if( internal_handle->sparse_read != 0 )
+		{
+			result = libbfio_internal_handle_get_extent_at_offset(
+			          internal_handle,
+			          internal_handle->current_offset,
+			          &extent_offset,
+			          &extent_size,
+			          &extent_flags,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent at offset: %" PRIi64 ".",
+				 function,
+				 internal_handle->current_offset );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				/* Do not read beyond the end of the extent
+				 */
+				extent_size -= (size64_t) ( internal_handle->current_offset - extent_offset );
+
+				if( (size64_t) read_size > extent_size )
+				{
+					read_size = (size_t) extent_size;
+				}
+			}
+		}
+		if( ( extent_flags & LIBBFIO_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			/* Holes are filled with zero bytes without reading them
+			 */
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = (ssize_t) read_size;
+
+			internal_handle->io_handle_offset_is_stale = 1;
+		}
+		else
+		{
+			if( internal_handle->io_handle_offset_is_stale != 0 )
+			{
+				if( libbfio_internal_handle_io_seek_offset(
+				     internal_handle,
+				     internal_handle->current_offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+					internal_handle->last_error_code   = LIBCERROR_IO_ERROR_SEEK_FAILED;
+
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek current offset: %" PRIi64 " in handle.",
+					 function,
+					 internal_handle->current_offset );
+
+					return( -1 );
+				}
+				internal_handle->io_handle_offset_is_stale = 0;
+			}
+			read_count = libbfio_internal_handle_io_read(
+			              internal_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+				internal_handle->last_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		libbfio_atomic_store_int64(
+		 &( internal_handle->current_offset ),
+		 internal_handle->current_offset + (off64_t) read_count );
+
+		buffer_offset += (size_t) read_count;
+
+		if( ( internal_handle->sparse_read == 0 )
+		 || ( read_count == 0 ) )
+		{
+			break;
+		}
+		/* A short read of data indicates the end of the data
+		 */
+		if( ( ( extent_flags & LIBBFIO_EXTENT_FLAG_IS_SPARSE ) == 0 )
+		 && ( (size_t) read_count < read_size ) )
+		{
+			break;
+		}
+	}
+
+	if( internal_handle->open_on_demand != 0 )
+	{
+		if( internal_handle->io_operations->close == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing close function.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_internal_handle_io_close(
+		     internal_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to close handle on demand.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Releases the descriptor of a handle that is opened on demand
+ * The handle is removed from the descriptor manager since it was closed after reading
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_release_descriptor(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_release_descriptor";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_descriptor_manager_remove_handle(
+	     internal_handle->descriptor_manager,
+	     (libbfio_handle_t *) internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove handle from descriptor manager.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_descriptor_manager_release_handle(
+	     internal_handle->descriptor_manager,
+	     (libbfio_handle_t *) internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads data at the current offset into the buffer
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_buffer(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libcerror_error_t **read_error             = NULL;
+	static char *function                      = "libbfio_handle_read_buffer";
+	off64_t read_offset                        = 0;
+	ssize_t read_count                         = 0;
+	uint8_t descriptor_acquired                = 0;
+	uint8_t track_offsets_read                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A handle that is opened on demand only uses a descriptor while it is being read
+	 */
+	if( ( internal_handle->open_on_demand != 0 )
+	 && ( internal_handle->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_acquire_handle(
+		     internal_handle->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_acquired = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_handle->last_error_domain = 0;
+	internal_handle->last_error_code   = 0;
+
+	/* The offset range read is tracked at the offset the read started at
+	 */
+	read_offset        = internal_handle->current_offset;
+	track_offsets_read = internal_handle->track_offsets_read;
+
+	/* In lightweight error mode the error is not set, which prevents
+	 * the error messages of all the layers from being formatted
+	 */
+	if( internal_handle->error_mode == LIBBFIO_ERROR_MODE_LIGHTWEIGHT )
+	{
+		read_error = NULL;
+	}
+	else
+	{
+		read_error = error;
+	}
+	read_count = libbfio_internal_handle_read_buffer(
+	              internal_handle,
+	              buffer,
+	              size,
+	              read_error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 read_error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		if( internal_handle->last_error_domain == 0 )
+		{
+			internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+			internal_handle->last_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+		}
+		read_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The offset range read is staged after the read/write lock is released
+	 */
+	if( ( track_offsets_read != 0 )
+	 && ( read_count > 0 ) )
+	{
+		if( libbfio_internal_handle_track_offset_read(
+		     internal_handle,
+		     read_offset,
+		     (size64_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to track offset range read.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( descriptor_acquired != 0 )
+	{
+		descriptor_acquired = 0;
+
+		if( libbfio_internal_handle_release_descriptor(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle to descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+
+on_error:
+	if( descriptor_acquired != 0 )
+	{
+		libbfio_internal_handle_release_descriptor(
+		 internal_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at a specific offset into the buffer
+ * The current offset is set to the end of the data read
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_read_buffer_at_offset(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_read_buffer_at_offset";
+	ssize_t read_count                         = 0;
+	uint8_t descriptor_acquired                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A handle that is opened on demand only uses a descriptor while it is being read
+	 */
+	if( ( internal_handle->open_on_demand != 0 )
+	 && ( internal_handle->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_acquire_handle(
+		     internal_handle->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_acquired = 1;
+	}
+	read_count = libbfio_internal_handle_read_buffer_at_offset(
+	              internal_handle,
+	              buffer,
+	              size,
+	              offset,
+	              1,
+	              error );
+
+	if( read_count < 0 )
+	{
+		goto on_error;
+	}
+	if( descriptor_acquired != 0 )
+	{
+		descriptor_acquired = 0;
+
+		if( libbfio_internal_handle_release_descriptor(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle to descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+
+on_error:
+	if( descriptor_acquired != 0 )
+	{
+		libbfio_internal_handle_release_descriptor(
+		 internal_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at a specific offset into the buffer
+ * If the IO handle can read at an offset, the handle is not opened on demand
+ * and not read sparse, the data is read while the read/write lock is grabbed
+ * for reading, hence reads at an offset on the same handle do not serialise.
+ * Otherwise the read/write lock is grabbed for writing for the seek and read.
+ * If update_current_offset is 0 the current offset is left unchanged
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_read_buffer_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint8_t update_current_offset,
+         libcerror_error_t **error )
+{
+	libcerror_error_t **read_error = NULL;
+	static char *function          = "libbfio_internal_handle_read_buffer_at_offset";
+	off64_t current_offset         = 0;
+	ssize_t read_count             = 0;
+	uint8_t read_at_offset         = 0;
+	uint8_t track_offsets_read     = 0;
+	int last_error_code            = 0;
+	int last_error_domain          = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_handle->read_at_offset != NULL )
+	 && ( internal_handle->open_on_demand == 0 )
+	 && ( internal_handle->sparse_read == 0 ) )
+	{
+		read_at_offset = 1;
+	}
+	track_offsets_read = internal_handle->track_offsets_read;
+
+	/* In lightweight error mode the error is not set, which prevents
+	 * the error messages of all the layers from being formatted
+	 */
+	if( internal_handle->error_mode == LIBBFIO_ERROR_MODE_LIGHTWEIGHT )
+	{
+		read_error = NULL;
+	}
+	else
+	{
+		read_error = error;
+	}
+	if( read_at_offset != 0 )
+	{
+		/* A negative offset is reported as a failed seek, as it is without the read at offset function
+		 */
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 read_error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
+			 function,
+			 offset,
+			 offset );
+
+			last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+			last_error_code   = LIBCERROR_IO_ERROR_SEEK_FAILED;
+
+			read_count = -1;
+		}
+		else
+		{
+			read_count = libbfio_internal_handle_io_read_at_offset(
+			              internal_handle,
+			              buffer,
+			              size,
+			              offset,
+			              read_error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 read_error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+				last_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+
+				read_count = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	/* The last error and the current offset are only changed while
+	 * the read/write lock is grabbed for writing
+	 */
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_at_offset != 0 )
+	{
+		internal_handle->last_error_domain = last_error_domain;
+		internal_handle->last_error_code   = last_error_code;
+
+		if( ( update_current_offset != 0 )
+		 && ( offset >= 0 ) )
+		{
+			current_offset = offset;
+
+			if( read_count > 0 )
+			{
+				current_offset += (off64_t) read_count;
+			}
+			libbfio_atomic_store_int64(
+			 &( internal_handle->current_offset ),
+			 current_offset );
+
+			internal_handle->io_handle_offset_is_stale = 1;
+		}
+	}
+	else
+	{
+		internal_handle->last_error_domain = 0;
+		internal_handle->last_error_code   = 0;
+
+		current_offset = internal_handle->current_offset;
+
+		if( libbfio_internal_handle_seek_offset(
+		     internal_handle,
+		     offset,
+		     SEEK_SET,
+		     read_error ) == -1 )
+		{
+			libcerror_error_set(
+			 read_error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
+			 function,
+			 offset,
+			 offset );
+
+			internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+			internal_handle->last_error_code   = LIBCERROR_IO_ERROR_SEEK_FAILED;
+
+			read_count = -1;
+		}
+		else
+		{
+			read_count = libbfio_internal_handle_read_buffer(
+			              internal_handle,
+			              buffer,
+			              size,
+			              read_error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 read_error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer.",
+				 function );
+
+				if( internal_handle->last_error_domain == 0 )
+				{
+					internal_handle->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+					internal_handle->last_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+				}
+				read_count = -1;
+			}
+		}
+		/* The IO handle is seeked back to the current offset before the next read or write
+		 */
+		if( update_current_offset == 0 )
+		{
+			libbfio_atomic_store_int64(
+			 &( internal_handle->current_offset ),
+			 current_offset );
+
+			internal_handle->io_handle_offset_is_stale = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The offset range read is staged after the read/write lock is released
+	 */
+	if( ( track_offsets_read != 0 )
+	 && ( read_count > 0 ) )
+	{
+		if( libbfio_internal_handle_track_offset_read(
+		     internal_handle,
+		     offset,
+		     (size64_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to track offset range read.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Reads data at a specific offset into the buffer without changing the current offset
+ * Reads from handles that cannot read at an offset serialise on the handle
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_handle_positional_read_buffer(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_positional_read_buffer";
+	ssize_t read_count                         = 0;
+	uint8_t descriptor_acquired                = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A handle that is opened on demand only uses a descriptor while it is being read
+	 */
+	if( ( internal_handle->open_on_demand != 0 )
+	 && ( internal_handle->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_acquire_handle(
+		     internal_handle->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to acquire handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_acquired = 1;
+	}
+	read_count = libbfio_internal_handle_read_buffer_at_offset(
+	              internal_handle,
+	              buffer,
+	              size,
+	              offset,
+	              0,
+	              error );
+
+	if( descriptor_acquired != 0 )
+	{
+		if( libbfio_internal_handle_release_descriptor(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle to descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Writes data at the current offset from the buffer
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_internal_handle_write_buffer(
+         libbfio_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_operations->write == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing write function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_handle_offset_is_stale != 0 )
+	{
+		if( internal_handle->io_operations->seek_offset == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing seek offset function.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_internal_handle_io_seek_offset(
+		     internal_handle,
+		     internal_handle->current_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek current offset: %" PRIi64 " in handle.",
+			 function,
+			 internal_handle->current_offset );
+
+			return( -1 );
+		}
+		internal_handle->io_handle_offset_is_stale = 0;
+	}
+	/* Written data can fill holes hence the extents need to be determined again
+	 */
+	if( internal_handle->extents != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_handle->extents ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extents array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	write_count = libbfio_internal_handle_io_write(
+	               internal_handle,
+	               buffer,
+	               size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to handle.",
+		 function );
+
+		return( -1 );
+	}
+	libbfio_atomic_store_int64(
+	 &( internal_handle->current_offset ),
+	 internal_handle->current_offset + (off64_t) write_count );
+
+	if( (size64_t) internal_handle->current_offset > internal_handle->size )
+	{
+		libbfio_atomic_store_int64(
+		 &( internal_handle->size ),
+		 (size64_t) internal_handle->current_offset );
+	}
+	return( write_count );
+}
+
+/* Writes data at the current offset from the buffer
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_handle_write_buffer(
+         libbfio_handle_t *handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_write_buffer";
+	ssize_t write_count                        = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = libbfio_internal_handle_write_buffer(
+	               internal_handle,
+	               buffer,
+	               size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to handle.",
+		 function );
+
+		write_count = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Writes data at a specific offset from the buffer
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_handle_write_buffer_at_offset(
+         libbfio_handle_t *handle,
+         const uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_write_buffer_at_offset";
+	ssize_t write_count                        = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_handle_seek_offset(
+	     internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
+		 function,
+		 offset,
+		 offset );
+
+		write_count = -1;
+	}
+	else
+	{
+		write_count = libbfio_internal_handle_write_buffer(
+		               internal_handle,
+		               buffer,
+		               size,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to handle.",
+			 function );
+
+			write_count = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( write_count );
+}
+
+/* Seeks a certain offset within the handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_internal_handle_seek_offset(
+         libbfio_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_handle_seek_offset";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_operations->seek_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing seek offset function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	offset = libbfio_internal_handle_io_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in handle.",
+		 function );
+
+		return( -1 );
+	}
+	libbfio_atomic_store_int64(
+	 &( internal_handle->current_offset ),
+	 offset );
+
+	internal_handle->io_handle_offset_is_stale = 0;
+
+	return( offset );
+}
+
+/* Seeks a certain offset within the handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_handle_seek_offset(
+         libbfio_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libbfio_internal_handle_seek_offset(
+	          internal_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in handle.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Function to determine if a file object exists
+ * Returns 1 if file object exists, 0 if not or -1 on error
+ */
+int libbfio_handle_exists(
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_exists";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_operations->exists == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing exists function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = internal_handle->io_operations->exists(
+	          internal_handle->io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle exists.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Check if the handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_handle_is_open(
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_is_open";
+	int result                                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_operations->is_open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing is open function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = internal_handle->io_operations->is_open(
+	          internal_handle->io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle is open.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_io_handle(
+     libbfio_handle_t *handle,
+     intptr_t **io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_io_handle";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*io_handle = internal_handle->io_handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the access flags
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_access_flags(
+     libbfio_handle_t *handle,
+     int *access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_access_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( access_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* With atomics the access flags are read without grabbing the read/write lock
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && !defined( HAVE_LIBBFIO_ATOMICS )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*access_flags = (int) libbfio_atomic_load_int32(
+	                       &( internal_handle->access_flags ) );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && !defined( HAVE_LIBBFIO_ATOMICS )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the access flags
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_access_flags(
+     libbfio_handle_t *handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_access_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libbfio_atomic_store_int32(
+	 &( internal_handle->access_flags ),
+	 access_flags );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_offset(
+     libbfio_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* With atomics the offset is read without grabbing the read/write lock
+	 * so that polling the offset does not block reading from the handle
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && !defined( HAVE_LIBBFIO_ATOMICS )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = (off64_t) libbfio_atomic_load_int64(
+	                     &( internal_handle->current_offset ) );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && !defined( HAVE_LIBBFIO_ATOMICS )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Returns the size of the data of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_size(
+     libbfio_handle_t *handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( internal_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT ) || defined( HAVE_LOCAL_LIBBFIO ) || defined( HAVE_LIBBFIO_ATOMICS )
+	/* A cached size is read without grabbing the read/write lock,
+	 * without atomics it is read while holding the read/write lock
+	 */
+	if( libbfio_atomic_load_uint8(
+	     &( internal_handle->size_set ) ) != 0 )
+	{
+		*size = (size64_t) libbfio_atomic_load_int64(
+		                    &( internal_handle->size ) );
+
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_handle->size_set == 0 )
+	{
+		if( internal_handle->io_operations->get_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid handle - missing get size function.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_handle->io_operations->get_size(
+		     internal_handle->io_handle,
+		     &( internal_handle->size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			goto on_error;
+		}
+		/* The size is stored before size set is stored with release semantics
+		 */
+		libbfio_atomic_store_uint8(
+		 &( internal_handle->size_set ),
+		 1 );
+	}
+	*size = internal_handle->size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Sets the value to have the library open and close
+ * the systems file descriptor or handle on demand
+ * 0 disables open on demand any other value enables it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_open_on_demand(
+     libbfio_handle_t *handle,
+     uint8_t open_on_demand,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_open_on_demand";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( ( internal_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	 && ( open_on_demand != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: open on demand cannot be used in combination with write access.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->open_on_demand = open_on_demand;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the descriptor manager
+ * The descriptor manager limits the number of descriptors used by the handles that share it
+ * A handle that is opened on demand is accounted for while it is being read, the handles
+ * of a pool are accounted for by the pool, refer to libbfio_pool_set_descriptor_manager
+ * The descriptor manager is not managed by the handle and must outlive it
+ * Use NULL to no longer use a descriptor manager
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_descriptor_manager(
+     libbfio_handle_t *handle,
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_descriptor_manager";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( ( internal_handle->descriptor_manager != NULL )
+	 && ( internal_handle->descriptor_manager != descriptor_manager ) )
+	{
+		if( libbfio_descriptor_manager_remove_handle(
+		     internal_handle->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_handle->descriptor_manager = descriptor_manager;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to have the library track the offsets read
+ * 0 disables tracking any other value enables it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_track_offsets_read(
+     libbfio_handle_t *handle,
+     uint8_t track_offsets_read,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_track_offsets_read";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( track_offsets_read != 0 )
+	 && ( internal_handle->offsets_read_mutex == NULL ) )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( internal_handle->offsets_read_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize offsets read mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+#if defined( LIBBFIO_THREAD_LOCAL )
+	if( ( result == 1 )
+	 && ( track_offsets_read != 0 )
+	 && ( internal_handle->offsets_read_stages_identifier == 0 ) )
+	{
+		internal_handle->offsets_read_stages_identifier = libbfio_atomic_increment_int64(
+		                                                   &libbfio_handle_last_offsets_read_stages_identifier );
+	}
+#endif
+	if( ( result == 1 )
+	 && ( track_offsets_read != 0 )
+	 && ( internal_handle->offsets_read == NULL ) )
+	{
+		if( libcdata_range_list_initialize(
+		     &( internal_handle->offsets_read ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read offsets list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_handle->track_offsets_read = track_offsets_read;
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of offsets read
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_number_of_offsets_read(
+     libbfio_handle_t *handle,
+     int *number_of_read_offsets,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_number_of_offsets_read";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( number_of_read_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read offsets.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->offsets_read == NULL )
+	{
+		*number_of_read_offsets = 0;
+	}
+	else if( libcdata_range_list_get_number_of_elements(
+	          internal_handle->offsets_read,
+	          number_of_read_offsets,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read offsets.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the information of an offset read
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_offset_read(
+     libbfio_handle_t *handle,
+     int index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	intptr_t *value                            = NULL;
+	static char *function                      = "libbfio_handle_get_offset_read";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->offsets_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_range_list_get_range_by_index(
+	          internal_handle->offsets_read,
+	          index,
+	          (uint64_t *) offset,
+	          (uint64_t *) size,
+	          &value,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read offset range: %d.",
+		 function,
+		 index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Sets the block size of the offsets read counts
+ * The number of times each block is read is tracked when the offsets read are tracked
+ * 0 disables tracking the read counts, changing the block size clears the read counts
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_offsets_read_block_size(
+     libbfio_handle_t *handle,
+     size64_t block_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_offsets_read_block_size";
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( block_size == 0 )
+	 && ( internal_handle->offsets_read_tracking_mode == LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size 0 in blocks tracking mode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( internal_handle->offsets_read_counts != NULL )
+		{
+			memory_free(
+			 internal_handle->offsets_read_counts );
+
+			internal_handle->offsets_read_counts = NULL;
+		}
+		internal_handle->number_of_offsets_read_counts = 0;
+
+		libbfio_atomic_store_int64(
+		 &( internal_handle->offsets_read_block_size ),
+		 block_size );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Determines the ranges of the blocks that were read or not read from the read counts
+ * This function is not multi-thread safe acquire read lock and the offsets read mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_get_ranges_from_read_counts(
+     libbfio_internal_handle_t *internal_handle,
+     uint8_t blocks_read,
+     size64_t handle_size,
+     off64_t *offsets,
+     size64_t *sizes,
+     int maximum_number_of_ranges,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	static char *function   = "libbfio_internal_handle_get_ranges_from_read_counts";
+	size64_t range_end      = 0;
+	size64_t range_start    = 0;
+	size_t block_index      = 0;
+	size_t number_of_blocks = 0;
+	uint8_t block_is_read   = 0;
+	int range_index         = -1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->offsets_read_block_size == 0 )
+	{
+		*number_of_ranges = 0;
+
+		return( 1 );
+	}
+	number_of_blocks = (size_t) ( ( handle_size + internal_handle->offsets_read_block_size - 1 ) / internal_handle->offsets_read_block_size );
+
+	/* Blocks read beyond the size of the handle are part of the ranges as well,
+	 * the read counts can be larger than the blocks read since they grow twofold
+	 */
+	for( block_index = internal_handle->number_of_offsets_read_counts;
+	     block_index > number_of_blocks;
+	     block_index-- )
+	{
+		if( internal_handle->offsets_read_counts[ block_index - 1 ] != 0 )
+		{
+			number_of_blocks = block_index;
+			handle_size      = (size64_t) number_of_blocks * internal_handle->offsets_read_block_size;
+
+			break;
+		}
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		block_is_read = 0;
+
+		if( ( block_index < internal_handle->number_of_offsets_read_counts )
+		 && ( internal_handle->offsets_read_counts[ block_index ] != 0 ) )
+		{
+			block_is_read = 1;
+		}
+		if( block_is_read != blocks_read )
+		{
+			continue;
+		}
+		range_start = (size64_t) block_index * internal_handle->offsets_read_block_size;
+		range_end   = range_start + internal_handle->offsets_read_block_size;
+
+		if( range_end > handle_size )
+		{
+			range_end = handle_size;
+		}
+		if( ( range_index >= 0 )
+		 && ( (size64_t) offsets[ range_index ] + sizes[ range_index ] == range_start ) )
+		{
+			sizes[ range_index ] += range_end - range_start;
+
+			continue;
+		}
+		range_index++;
+
+		if( range_index >= maximum_number_of_ranges )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid maximum number of ranges value too small.",
+			 function );
+
+			return( -1 );
+		}
+		offsets[ range_index ] = (off64_t) range_start;
+		sizes[ range_index ]   = range_end - range_start;
+	}
+	*number_of_ranges = range_index + 1;
+
+	return( 1 );
+}
+
+/* Retrieves all the offsets read
+ * The offsets and sizes arrays must be able to contain the maximum number of ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_offsets_read(
+     libbfio_handle_t *handle,
+     off64_t *offsets,
+     size64_t *sizes,
+     int maximum_number_of_ranges,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	intptr_t *value                            = NULL;
+	static char *function                      = "libbfio_handle_get_offsets_read";
+	size64_t handle_size                       = 0;
+	int number_of_offsets_read                 = 0;
+	int range_index                            = 0;
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->offsets_read_tracking_mode == LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS )
+	{
+		/* Without a known size the ranges are determined by the read counts
+		 */
+		if( internal_handle->size_set != 0 )
+		{
+			handle_size = internal_handle->size;
+		}
+		result = libbfio_internal_handle_get_ranges_from_read_counts(
+		          internal_handle,
+		          1,
+		          handle_size,
+		          offsets,
+		          sizes,
+		          maximum_number_of_ranges,
+		          &number_of_offsets_read,
+		          error );
+	}
+	else
+	{
+		if( internal_handle->offsets_read != NULL )
+		{
+			if( libcdata_range_list_get_number_of_elements(
+			     internal_handle->offsets_read,
+			     &number_of_offsets_read,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of read offsets.",
+				 function );
+
+				result = -1;
+			}
+			else if( number_of_offsets_read > maximum_number_of_ranges )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid maximum number of ranges value too small.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The ranges are retrieved in order which the range list handles in a single pass
+		 */
+		for( range_index = 0;
+		     ( result == 1 ) && ( range_index < number_of_offsets_read );
+		     range_index++ )
+		{
+			if( libcdata_range_list_get_range_by_index(
+			     internal_handle->offsets_read,
+			     range_index,
+			     (uint64_t *) &( offsets[ range_index ] ),
+			     (uint64_t *) &( sizes[ range_index ] ),
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve read offset range: %d.",
+				 function,
+				 range_index );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		*number_of_ranges = number_of_offsets_read;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves all the offsets not read, which are the gaps between the offsets read
+ * The offsets and sizes arrays must be able to contain the maximum number of ranges
+ * which is at most the number of offsets read + 1
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_offsets_not_read(
+     libbfio_handle_t *handle,
+     off64_t *offsets,
+     size64_t *sizes,
+     int maximum_number_of_ranges,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	intptr_t *value                            = NULL;
+	static char *function                      = "libbfio_handle_get_offsets_not_read";
+	size64_t handle_size                       = 0;
+	uint64_t gap_offset                        = 0;
+	uint64_t range_offset                      = 0;
+	uint64_t range_size                        = 0;
+	int number_of_gaps                         = 0;
+	int number_of_offsets_read                 = 0;
+	int range_index                            = 0;
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     handle,
+	     &handle_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->offsets_read_tracking_mode == LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS )
+	{
+		result = libbfio_internal_handle_get_ranges_from_read_counts(
+		          internal_handle,
+		          0,
+		          handle_size,
+		          offsets,
+		          sizes,
+		          maximum_number_of_ranges,
+		          &number_of_gaps,
+		          error );
+	}
+	else
+	{
+		if( internal_handle->offsets_read != NULL )
+		{
+			if( libcdata_range_list_get_number_of_elements(
+			     internal_handle->offsets_read,
+			     &number_of_offsets_read,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* Every range read can be preceded by a gap and one more gap can follow the last range
+		 */
+		for( range_index = 0;
+		     ( result == 1 ) && ( range_index <= number_of_offsets_read );
+		     range_index++ )
+		{
+			if( range_index < number_of_offsets_read )
+			{
+				if( libcdata_range_list_get_range_by_index(
+				     internal_handle->offsets_read,
+				     range_index,
+				     &range_offset,
+				     &range_size,
+				     &value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve read offset range: %d.",
+					 function,
+					 range_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+			else
+			{
+				range_offset = (uint64_t) handle_size;
+				range_size   = 0;
+			}
+			if( range_offset > (uint64_t) handle_size )
+			{
+				range_offset = (uint64_t) handle_size;
+			}
+			if( range_offset > gap_offset )
+			{
+				if( number_of_gaps >= maximum_number_of_ranges )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid maximum number of ranges value too small.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+				offsets[ number_of_gaps ] = (off64_t) gap_offset;
+				sizes[ number_of_gaps ]   = (size64_t) ( range_offset - gap_offset );
+
+				number_of_gaps++;
+			}
+			if( ( range_offset + range_size ) > gap_offset )
+			{
+				gap_offset = range_offset + range_size;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		*number_of_ranges = number_of_gaps;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the read counts of the blocks of the offsets read
+ * The read counts of blocks that were not read are 0
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_get_offsets_read_heatmap(
+     libbfio_handle_t *handle,
+     uint32_t *read_counts,
+     size_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_offsets_read_heatmap";
+	size_t block_index                         = 0;
+	size_t number_of_offsets_read_counts       = 0;
+	int result                                 = 1;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of blocks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_handle->offsets_read_block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing offsets read block size.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		number_of_offsets_read_counts = internal_handle->number_of_offsets_read_counts;
+
+		if( number_of_offsets_read_counts > number_of_blocks )
+		{
+			number_of_offsets_read_counts = number_of_blocks;
+		}
+		for( block_index = 0;
+		     block_index < number_of_offsets_read_counts;
+		     block_index++ )
+		{
+			read_counts[ block_index ] = internal_handle->offsets_read_counts[ block_index ];
+		}
+		while( block_index < number_of_blocks )
+		{
+			read_counts[ block_index++ ] = 0;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_read(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Sets the offsets read tracking mode
+ * In the ranges mode the exact offset ranges read are tracked and, when a block size is set,
+ * the read counts. In the blocks mode only the read counts are tracked, which requires a block size
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_offsets_read_tracking_mode(
+     libbfio_handle_t *handle,
+     int tracking_mode,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_offsets_read_tracking_mode";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -1217,21 +6097,23 @@ ssize_t libbfio_handle_read_buffer(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( ( tracking_mode != LIBBFIO_OFFSETS_READ_TRACKING_MODE_RANGES )
+	 && ( tracking_mode != LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported tracking mode.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1243,27 +6125,72 @@ ssize_t libbfio_handle_read_buffer(
 		return( -1 );
 	}
 #endif
-	read_count = libbfio_internal_handle_read_buffer(
-	              internal_handle,
-	              buffer,
-	              size,
-	              error );
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab offsets read mutex.",
+		 function );
 
-	if( read_count < 0 )
+		goto on_error;
+	}
+#endif
+	if( libbfio_internal_handle_merge_staged_offsets_read(
+	     internal_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to merge staged offsets read.",
 		 function );
 
-		read_count = -1;
+		result = -1;
+	}
+	else if( ( tracking_mode == LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS )
+	 && ( internal_handle->offsets_read_block_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing offsets read block size.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_handle->offsets_read_tracking_mode = tracking_mode;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1275,22 +6202,33 @@ ssize_t libbfio_handle_read_buffer(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
 }
 
-/* Reads data at a specific offset into the buffer
- * Returns the number of bytes read if successful, or -1 on error
+/* Sets the offsets read sampling interval
+ * Only the first of every interval number of reads is tracked, 0 or 1 tracks every read
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_read_buffer_at_offset(
-         libbfio_handle_t *handle,
-         uint8_t *buffer,
-         size_t size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libbfio_handle_set_offsets_read_sampling_interval(
+     libbfio_handle_t *handle,
+     uint32_t sampling_interval,
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_read_buffer_at_offset";
-	ssize_t read_count                         = 0;
+	libbfio_offsets_read_stage_t *stage        = NULL;
+	static char *function                      = "libbfio_handle_set_offsets_read_sampling_interval";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -1305,73 +6243,107 @@ ssize_t libbfio_handle_read_buffer_at_offset(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_grab(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab offsets read mutex.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	if( libbfio_internal_handle_seek_offset(
-	     internal_handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
-		 function,
-		 offset,
-		 offset );
+	libbfio_atomic_store_int32(
+	 &( internal_handle->offsets_read_sampling_interval ),
+	 sampling_interval );
 
-		read_count = -1;
-	}
-	else
+	/* Every stage restarts the sampling interval
+	 */
+	for( stage = internal_handle->offsets_read_stages;
+	     stage != NULL;
+	     stage = stage->next_stage )
 	{
-		read_count = libbfio_internal_handle_read_buffer(
-		              internal_handle,
-		              buffer,
-		              size,
-		              error );
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_grab(
+		     stage->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab offsets read stage mutex.",
+			 function );
+
+			result = -1;
 
-		if( read_count < 0 )
+			break;
+		}
+#endif
+		stage->sample_counter = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_release(
+		     stage->mutex,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release offsets read stage mutex.",
 			 function );
 
-			read_count = -1;
+			result = -1;
+
+			break;
 		}
+#endif
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->offsets_read_mutex != NULL )
+	 && ( libcthreads_mutex_release(
+	       internal_handle->offsets_read_mutex,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release offsets read mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1383,23 +6355,35 @@ ssize_t libbfio_handle_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
 }
 
-/* Writes data at the current offset from the buffer
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes written if successful, or -1 on error
+/* Sets the get extents function
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_internal_handle_write_buffer(
-         libbfio_internal_handle_t *internal_handle,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_handle_set_get_extents_function(
+     libbfio_handle_t *handle,
+     int (*get_extents)(
+            intptr_t *io_handle,
+            libcdata_array_t *extents_array,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
 {
-	static char *function = "libbfio_internal_handle_write_buffer";
-	ssize_t write_count   = 0;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_get_extents_function";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1410,77 +6394,126 @@ ssize_t libbfio_internal_handle_write_buffer(
 
 		return( -1 );
 	}
-	if( internal_handle->write == NULL )
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing write function.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+#endif
+	internal_handle->get_extents = get_extents;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( size > (size_t) SSIZE_MAX )
+#endif
+	return( 1 );
+}
+
+/* Sets the set access hint function
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_handle_set_access_hint_function(
+     libbfio_handle_t *handle,
+     int (*set_access_hint)(
+            intptr_t *io_handle,
+            int access_hint,
+            off64_t offset,
+            size64_t size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_set_access_hint_function";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	write_count = internal_handle->write(
-	               internal_handle->io_handle,
-	               buffer,
-	               size,
-	               error );
+	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( write_count < 0 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->current_offset += (off64_t) write_count;
+#endif
+	internal_handle->set_access_hint = set_access_hint;
 
-	if( (size64_t) internal_handle->current_offset > internal_handle->size )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
-		internal_handle->size = (size64_t) internal_handle->current_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
-	return( write_count );
+#endif
+	return( 1 );
 }
 
-/* Writes data at the current offset from the buffer
- * Returns the number of bytes written if successful, or -1 on error
+/* Sets the read at offset function
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_handle_write_buffer(
-         libbfio_handle_t *handle,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_handle_set_read_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_write_buffer";
-	ssize_t write_count                        = 0;
+	static char *function                      = "libbfio_handle_set_read_at_offset_function";
 
 	if( handle == NULL )
 	{
@@ -1494,22 +6527,12 @@ ssize_t libbfio_handle_write_buffer(
 		return( -1 );
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1521,27 +6544,13 @@ ssize_t libbfio_handle_write_buffer(
 		return( -1 );
 	}
 #endif
-	write_count = libbfio_internal_handle_write_buffer(
-	               internal_handle,
-	               buffer,
-	               size,
-	               error );
-
-	if( write_count < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write to handle.",
-		 function );
+	internal_handle->read_at_offset = read_at_offset;
 
-		write_count = -1;
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1553,22 +6562,25 @@ ssize_t libbfio_handle_write_buffer(
 		return( -1 );
 	}
 #endif
-	return( write_count );
+	return( 1 );
 }
 
-/* Writes data at a specific offset from the buffer
- * Returns the number of bytes written if successful, or -1 on error
+/* Passes an access hint to the IO handle
+ * The normal, sequential and random access hints describe the access pattern
+ * The will need and do not need access hints apply to the range defined
+ * by offset and size, where a size of 0 represents the remainder of the data
+ * Returns 1 if successful, 0 if not supported or -1 on error
  */
-ssize_t libbfio_handle_write_buffer_at_offset(
-         libbfio_handle_t *handle,
-         const uint8_t *buffer,
-         size_t size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libbfio_handle_set_access_hint(
+     libbfio_handle_t *handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_write_buffer_at_offset";
-	ssize_t write_count                        = 0;
+	static char *function                      = "libbfio_handle_set_access_hint";
+	int result                                 = 0;
 
 	if( handle == NULL )
 	{
@@ -1583,73 +6595,83 @@ ssize_t libbfio_handle_write_buffer_at_offset(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
+	if( ( access_hint != LIBBFIO_ACCESS_HINT_NORMAL )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_SEQUENTIAL )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_RANDOM )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_WILLNEED )
+	 && ( access_hint != LIBBFIO_ACCESS_HINT_DONTNEED ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access hint.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libbfio_internal_handle_seek_offset(
-	     internal_handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( size > (size64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in handle.",
-		 function,
-		 offset,
-		 offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
 
-		write_count = -1;
+		return( -1 );
 	}
-	else
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
-		write_count = libbfio_internal_handle_write_buffer(
-		               internal_handle,
-		               buffer,
-		               size,
-		               error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-		if( write_count < 0 )
+		return( -1 );
+	}
+#endif
+	if( internal_handle->set_access_hint != NULL )
+	{
+		result = internal_handle->set_access_hint(
+		          internal_handle->io_handle,
+		          access_hint,
+		          offset,
+		          size,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access hint.",
 			 function );
-
-			write_count = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1661,22 +6683,25 @@ ssize_t libbfio_handle_write_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( write_count );
+	return( result );
 }
 
-/* Seeks a certain offset within the handle
- * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if the seek is successful or -1 on error
+/* Prefetches data of the handle
+ * The function returns immediately and the data is read asynchronously
+ * by the operating system, where a size of 0 represents the remainder of the data
+ * Returns 1 if successful, 0 if not supported or -1 on error
  */
-off64_t libbfio_internal_handle_seek_offset(
-         libbfio_internal_handle_t *internal_handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libbfio_handle_prefetch(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
 {
-	static char *function = "libbfio_internal_handle_seek_offset";
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_prefetch";
+	int result                                 = 0;
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1687,63 +6712,101 @@ off64_t libbfio_internal_handle_seek_offset(
 
 		return( -1 );
 	}
-	if( internal_handle->seek_offset == NULL )
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing seek offset function.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( size > (size64_t) INT64_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	offset = internal_handle->seek_offset(
-	          internal_handle->io_handle,
-	          offset,
-	          whence,
-	          error );
-
-	if( offset == -1 )
+	/* A prefetch does not change the state of the handle
+	 * hence it can be issued concurrently with other readers
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->current_offset = offset;
+#endif
+	if( internal_handle->set_access_hint != NULL )
+	{
+		result = internal_handle->set_access_hint(
+		          internal_handle->io_handle,
+		          LIBBFIO_ACCESS_HINT_WILLNEED,
+		          offset,
+		          size,
+		          error );
 
-	return( offset );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to prefetch data at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
-/* Seeks a certain offset within the handle
- * Returns the offset if the seek is successful or -1 on error
+/* Sets the value to have the library read sparse data
+ * In sparse read mode holes are filled with zero bytes without reading them
+ * and reads do not cross the boundary of a data and a hole extent
+ * 0 disables sparse read any other value enables it
+ * Returns 1 if successful or -1 on error
  */
-off64_t libbfio_handle_seek_offset(
-         libbfio_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libbfio_handle_set_sparse_read(
+     libbfio_handle_t *handle,
+     uint8_t sparse_read,
+     libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_seek_offset";
+	static char *function                      = "libbfio_handle_set_sparse_read";
 
 	if( handle == NULL )
 	{
@@ -1758,21 +6821,11 @@ off64_t libbfio_handle_seek_offset(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1784,27 +6837,13 @@ off64_t libbfio_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libbfio_internal_handle_seek_offset(
-	          internal_handle,
-	          offset,
-	          whence,
-	          error );
-
-	if( offset == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in handle.",
-		 function );
+	internal_handle->sparse_read = sparse_read;
 
-		offset = -1;
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1816,19 +6855,19 @@ off64_t libbfio_handle_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( 1 );
 }
 
-/* Function to determine if a file object exists
- * Returns 1 if file object exists, 0 if not or -1 on error
+/* Retrieves the error mode
+ * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_exists(
+int libbfio_handle_get_error_mode(
      libbfio_handle_t *handle,
+     int *error_mode,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_exists";
-	int result                                 = 0;
+	static char *function                      = "libbfio_handle_get_error_mode";
 
 	if( handle == NULL )
 	{
@@ -1843,32 +6882,22 @@ int libbfio_handle_exists(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_handle->exists == NULL )
+	if( error_mode == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing exists function.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error mode.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1880,25 +6909,13 @@ int libbfio_handle_exists(
 		return( -1 );
 	}
 #endif
-	result = internal_handle->exists(
-	          internal_handle->io_handle,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if handle exists.",
-		 function );
+	*error_mode = internal_handle->error_mode;
 
-		goto on_error;
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1910,27 +6927,22 @@ int libbfio_handle_exists(
 		return( -1 );
 	}
 #endif
-	return( result );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 1 );
 }
 
-/* Check if the handle is open
- * Returns 1 if open, 0 if not or -1 on error
+/* Sets the error mode
+ * In lightweight error mode a failed read does not set the error but only records
+ * the error domain and code, this avoids formatting and allocating error messages
+ * for reads that are expected to fail, such as those of format probing
+ * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_is_open(
+int libbfio_handle_set_error_mode(
      libbfio_handle_t *handle,
+     int error_mode,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_is_open";
-	int result                                 = 0;
+	static char *function                      = "libbfio_handle_set_error_mode";
 
 	if( handle == NULL )
 	{
@@ -1945,94 +6957,68 @@ int libbfio_handle_is_open(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( internal_handle->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_handle->is_open == NULL )
+	if( ( error_mode != LIBBFIO_ERROR_MODE_DEFAULT )
+	 && ( error_mode != LIBBFIO_ERROR_MODE_LIGHTWEIGHT ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing is open function.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported error mode.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = internal_handle->is_open(
-	          internal_handle->io_handle,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if handle is open.",
-		 function );
+	internal_handle->error_mode = error_mode;
 
-		goto on_error;
-	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_read(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the IO handle
- * Returns 1 if successful or -1 on error
+/* Retrieves the error domain and code of the last failed read
+ * The error domain and code are recorded in both the default and lightweight error mode
+ * Returns 1 if successful, 0 if the last read did not fail or -1 on error
  */
-int libbfio_handle_get_io_handle(
+int libbfio_handle_get_last_error(
      libbfio_handle_t *handle,
-     intptr_t **io_handle,
+     int *error_domain,
+     int *error_code,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_io_handle";
+	static char *function                      = "libbfio_handle_get_last_error";
+	int result                                 = 0;
 
 	if( handle == NULL )
 	{
@@ -2047,21 +7033,33 @@ int libbfio_handle_get_io_handle(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( io_handle == NULL )
+	if( error_domain == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid error domain.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2073,12 +7071,18 @@ int libbfio_handle_get_io_handle(
 		return( -1 );
 	}
 #endif
-	*io_handle = internal_handle->io_handle;
+	if( internal_handle->last_error_domain != 0 )
+	{
+		*error_domain = internal_handle->last_error_domain;
+		*error_code   = internal_handle->last_error_code;
 
+		result = 1;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_read(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2090,19 +7094,19 @@ int libbfio_handle_get_io_handle(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the access flags
+/* Sets if the lock statistics should be tracked
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_get_access_flags(
+int libbfio_handle_set_track_lock_statistics(
      libbfio_handle_t *handle,
-     int *access_flags,
+     uint8_t track_lock_statistics,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_access_flags";
+	static char *function                      = "libbfio_handle_set_track_lock_statistics";
 
 	if( handle == NULL )
 	{
@@ -2117,62 +7121,124 @@ int libbfio_handle_get_access_flags(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( access_flags == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_set_track_statistics(
+	       internal_handle->read_write_lock,
+	       track_lock_statistics,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track lock statistics.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+#else
+	LIBBFIO_UNREFERENCED_PARAMETER( internal_handle )
+	LIBBFIO_UNREFERENCED_PARAMETER( track_lock_statistics )
+#endif
+	return( 1 );
+}
+
+/* Retrieves the lock statistics
+ * The number of grabs, the number of grabs that had to wait for the lock
+ * and the total and maximum wait time in nano seconds
+ * Returns 1 if successful, 0 if the handle has no lock or -1 on error
+ */
+int libbfio_handle_get_lock_statistics(
+     libbfio_handle_t *handle,
+     uint64_t *number_of_grabs,
+     uint64_t *number_of_contended_grabs,
+     uint64_t *total_wait_time,
+     uint64_t *maximum_wait_time,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_handle_get_lock_statistics";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*access_flags = internal_handle->access_flags;
+	internal_handle = (libbfio_internal_handle_t *) handle;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( internal_handle->read_write_lock == NULL )
+	{
+		return( 0 );
+	}
+	/* The lock is not grabbed since that would affect the statistics
+	 */
+	if( libbfio_lock_get_statistics(
 	     internal_handle->read_write_lock,
+	     number_of_grabs,
+	     number_of_contended_grabs,
+	     total_wait_time,
+	     maximum_wait_time,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lock statistics.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	return( 1 );
+#else
+	LIBBFIO_UNREFERENCED_PARAMETER( internal_handle )
+	LIBBFIO_UNREFERENCED_PARAMETER( number_of_grabs )
+	LIBBFIO_UNREFERENCED_PARAMETER( number_of_contended_grabs )
+	LIBBFIO_UNREFERENCED_PARAMETER( total_wait_time )
+	LIBBFIO_UNREFERENCED_PARAMETER( maximum_wait_time )
+
+	return( 0 );
+#endif
 }
 
-/* Sets the access flags
+/* Sets the trace callbacks
+ * The pre callback is called before and the post callback after every open,
+ * close, seek, read and write with the duration in nano seconds
+ * The entry is -1 for the operations of the handle
+ * The callbacks are called while the lock is held and should not call back
+ * into the handle, tracing is disabled when both callbacks are NULL
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_set_access_flags(
+int libbfio_handle_set_trace_callbacks(
      libbfio_handle_t *handle,
-     int access_flags,
+     void (*pre_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size ),
+     void (*post_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size,
+            int64_t result,
+            uint64_t duration ),
+     intptr_t *callback_data,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_set_access_flags";
+	static char *function                      = "libbfio_handle_set_trace_callbacks";
+	int result                                 = 1;
 
 	if( handle == NULL )
 	{
@@ -2187,39 +7253,43 @@ int libbfio_handle_set_access_flags(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+#endif
+	if( libbfio_trace_set_callbacks(
+	     &( internal_handle->trace ),
+	     pre_callback,
+	     post_callback,
+	     callback_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to set trace callbacks.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	internal_handle->access_flags = access_flags;
-
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2231,91 +7301,201 @@ int libbfio_handle_set_access_flags(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the current offset
+/* Sets the trace recorder
+ * The trace recorder is not managed by the handle, use NULL to remove it
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_get_offset(
+int libbfio_handle_set_trace_recorder(
      libbfio_handle_t *handle,
-     off64_t *offset,
+     libbfio_trace_recorder_t *trace_recorder,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_offset";
+	static char *function = "libbfio_handle_set_trace_recorder";
+	int result            = 0;
 
-	if( handle == NULL )
+	if( trace_recorder == NULL )
+	{
+		result = libbfio_handle_set_trace_callbacks(
+		          handle,
+		          NULL,
+		          NULL,
+		          NULL,
+		          error );
+	}
+	else
+	{
+		result = libbfio_handle_set_trace_callbacks(
+		          handle,
+		          NULL,
+		          &libbfio_trace_recorder_post_callback,
+		          (intptr_t *) trace_recorder,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callbacks.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	return( 1 );
+}
 
-	if( offset == NULL )
+/* Determines the extents
+ * If the IO handle does not provide extents a single data extent is used
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_handle_determine_extents(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *extents_array = NULL;
+	static char *function           = "libbfio_internal_handle_determine_extents";
+	int result                      = 0;
+
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
+	if( internal_handle->extents != NULL )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_initialize(
+	     &extents_array,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extents array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*offset = internal_handle->current_offset;
+	if( internal_handle->get_extents != NULL )
+	{
+		result = internal_handle->get_extents(
+		          internal_handle->io_handle,
+		          extents_array,
+		          error );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( internal_handle->size_set == 0 )
+		{
+			if( internal_handle->io_operations->get_size == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid handle - missing get size function.",
+				 function );
 
-		return( -1 );
+				goto on_error;
+			}
+			if( internal_handle->io_operations->get_size(
+			     internal_handle->io_handle,
+			     &( internal_handle->size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size.",
+				 function );
+
+				goto on_error;
+			}
+			libbfio_atomic_store_uint8(
+			 &( internal_handle->size_set ),
+			 1 );
+		}
+		if( internal_handle->size > 0 )
+		{
+			if( libbfio_extent_append_to_array(
+			     extents_array,
+			     0,
+			     internal_handle->size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data extent.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
-#endif
+	internal_handle->extents = extents_array;
+
 	return( 1 );
+
+on_error:
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Returns the size of the data of the handle
- * Returns 1 if successful or -1 on error
+/* Retrieves the extent that contains a specific offset
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if no such extent or -1 on error
  */
-int libbfio_handle_get_size(
-     libbfio_handle_t *handle,
-     size64_t *size,
+int libbfio_internal_handle_get_extent_at_offset(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_size";
+	libbfio_extent_t *extent = NULL;
+	static char *function    = "libbfio_internal_handle_get_extent_at_offset";
+	int lower_index          = 0;
+	int middle_index         = 0;
+	int upper_index          = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2326,114 +7506,130 @@ int libbfio_handle_get_size(
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
 
-	if( internal_handle->io_handle == NULL )
+		return( -1 );
+	}
+	if( extent_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( extent_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size",
+		 "%s: invalid extent flags.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+	if( libbfio_internal_handle_determine_extents(
+	     internal_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extents.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_handle->size_set == 0 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->extents,
+	     &upper_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extents are stored in order of their offset
+	 */
+	while( lower_index < upper_index )
 	{
-		if( internal_handle->get_size == NULL )
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->extents,
+		     middle_index,
+		     (intptr_t **) &extent,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid handle - missing get size function.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 middle_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( internal_handle->get_size(
-		     internal_handle->io_handle,
-		     &( internal_handle->size ),
-		     error ) != 1 )
+		if( extent == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 middle_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_handle->size_set = 1;
-	}
-	*size = internal_handle->size;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		if( offset < extent->offset )
+		{
+			upper_index = middle_index;
+		}
+		else if( (size64_t) ( offset - extent->offset ) >= extent->size )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*extent_offset = extent->offset;
+			*extent_size   = extent->size;
+			*extent_flags  = extent->flags;
 
-		return( -1 );
+			return( 1 );
+		}
 	}
-#endif
-	return( 1 );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_handle->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 0 );
 }
 
-/* Sets the value to have the library open and close
- * the systems file descriptor or handle on demand
- * 0 disables open on demand any other value enables it
+/* Retrieves the number of extents
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_set_open_on_demand(
+int libbfio_handle_get_number_of_extents(
      libbfio_handle_t *handle,
-     uint8_t open_on_demand,
+     int *number_of_extents,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_set_open_on_demand";
+	static char *function                      = "libbfio_handle_get_number_of_extents";
 
 	if( handle == NULL )
 	{
@@ -2448,39 +7644,54 @@ int libbfio_handle_set_open_on_demand(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-	if( ( ( internal_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
-	 && ( open_on_demand != 0 ) )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: open on demand cannot be used in combination with write access.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
+#endif
+	if( libbfio_internal_handle_determine_extents(
+	     internal_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extents.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	internal_handle->open_on_demand = open_on_demand;
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->extents,
+	     number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
 
+		goto on_error;
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2493,19 +7704,33 @@ int libbfio_handle_set_open_on_demand(
 	}
 #endif
 	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
 }
 
-/* Sets the value to have the library track the offsets read
- * 0 disables tracking any other value enables it
+/* Retrieves a specific extent
  * Returns 1 if successful or -1 on error
  */
-int libbfio_handle_set_track_offsets_read(
+int libbfio_handle_get_extent_by_index(
      libbfio_handle_t *handle,
-     uint8_t track_offsets_read,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
+	libbfio_extent_t *extent                   = NULL;
 	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_set_track_offsets_read";
+	static char *function                      = "libbfio_handle_get_extent_by_index";
 
 	if( handle == NULL )
 	{
@@ -2520,127 +7745,145 @@ int libbfio_handle_set_track_offsets_read(
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( extent_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	internal_handle->track_offsets_read = track_offsets_read;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( extent_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves the number of offsets read
- * Returns 1 if successful or -1 on error
- */
-int libbfio_handle_get_number_of_offsets_read(
-     libbfio_handle_t *handle,
-     int *number_of_read_offsets,
-     libcerror_error_t **error )
-{
-	libbfio_internal_handle_t *internal_handle = NULL;
-	static char *function                      = "libbfio_handle_get_number_of_offsets_read";
-	int result                                 = 1;
-
-	if( handle == NULL )
+	if( extent_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid extent flags.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcdata_range_list_get_number_of_elements(
-	     internal_handle->offsets_read,
-	     number_of_read_offsets,
+	if( libbfio_internal_handle_determine_extents(
+	     internal_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of read offsets.",
+		 "%s: unable to determine extents.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->extents,
+	     extent_index,
+	     (intptr_t **) &extent,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 extent_index );
+
+		goto on_error;
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing extent: %d.",
+		 function,
+		 extent_index );
+
+		goto on_error;
+	}
+	*extent_offset = extent->offset;
+	*extent_size   = extent->size;
+	*extent_flags  = extent->flags;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
 }
 
-/* Retrieves the information of an offset read
- * Returns 1 if successful or -1 on error
+/* Retrieves the extent that contains a specific offset
+ * This allows callers to skip holes without reading them
+ * Returns 1 if successful, 0 if no such extent or -1 on error
  */
-int libbfio_handle_get_offset_read(
+int libbfio_handle_get_extent_at_offset(
      libbfio_handle_t *handle,
-     int index,
-     off64_t *offset,
-     size64_t *size,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
      libcerror_error_t **error )
 {
 	libbfio_internal_handle_t *internal_handle = NULL;
-	intptr_t *value                            = NULL;
-	static char *function                      = "libbfio_handle_get_offset_read";
-	int result                                 = 1;
+	static char *function                      = "libbfio_handle_get_extent_at_offset";
+	int result                                 = 0;
 
 	if( handle == NULL )
 	{
@@ -2656,53 +7899,68 @@ int libbfio_handle_get_offset_read(
 	internal_handle = (libbfio_internal_handle_t *) handle;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_grab_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcdata_range_list_get_range_by_index(
-	     internal_handle->offsets_read,
-	     index,
-	     (uint64_t *) offset,
-	     (uint64_t *) size,
-	     &value,
-	     error ) != 1 )
+	result = libbfio_internal_handle_get_extent_at_offset(
+	          internal_handle,
+	          offset,
+	          extent_offset,
+	          extent_size,
+	          extent_flags,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve read offset range: %d.",
+		 "%s: unable to retrieve extent at offset: %" PRIi64 ".",
 		 function,
-		 index );
+		 offset );
 
-		result = -1;
+		goto on_error;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_handle->read_write_lock,
-	     error ) != 1 )
+	if( ( internal_handle->read_write_lock != NULL )
+	 && ( libbfio_lock_release_for_write(
+	       internal_handle->read_write_lock,
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
 	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( internal_handle->read_write_lock != NULL )
+	{
+		libbfio_lock_release_for_write(
+		 internal_handle->read_write_lock,
+		 NULL );
+	}
+#endif
+	return( -1 );
 }
 
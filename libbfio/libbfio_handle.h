@@ -25,16 +25,68 @@
 #include <common.h>
 #include <types.h>
 
+#include "libbfio_arena.h"
 #include "libbfio_extern.h"
+#include "libbfio_io_operations.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcthreads.h"
+#include "libbfio_lock.h"
+#include "libbfio_trace.h"
 #include "libbfio_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The number of offset ranges read that are staged before they are merged into the offsets read list
+ */
+#define LIBBFIO_HANDLE_NUMBER_OF_STAGED_OFFSETS_READ	64
+
+typedef struct libbfio_staged_offset_read libbfio_staged_offset_read_t;
+
+struct libbfio_staged_offset_read
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+typedef struct libbfio_offsets_read_stage libbfio_offsets_read_stage_t;
+
+struct libbfio_offsets_read_stage
+{
+	/* The next stage
+	 */
+	libbfio_offsets_read_stage_t *next_stage;
+
+	/* The thread that owns the stage, NULL if the stage is shared by all threads
+	 */
+	intptr_t *owner;
+
+	/* The staged offset ranges read
+	 */
+	libbfio_staged_offset_read_t offsets_read[ LIBBFIO_HANDLE_NUMBER_OF_STAGED_OFFSETS_READ ];
+
+	/* The number of staged offset ranges read
+	 */
+	int number_of_offsets_read;
+
+	/* The number of reads since the last sampled read
+	 */
+	uint32_t sample_counter;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The mutex, which is only contended when the stage is merged
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
 typedef struct libbfio_internal_handle libbfio_internal_handle_t;
 
 struct libbfio_internal_handle
@@ -43,17 +95,26 @@ struct libbfio_internal_handle
 	 */
 	intptr_t *io_handle;
 
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The IO operations, which are typically shared by
+	 * all the handles of the same type
+	 */
+	const libbfio_io_operations_t *io_operations;
+
 	/* The flags
 	 */
 	uint8_t flags;
 
-	/* The access flags
+	/* Value to indicate the handle was allocated from an arena
 	 */
-	int access_flags;
+	uint8_t is_arena_allocated;
 
-	/* The current offset
+	/* The access flags
 	 */
-	off64_t current_offset;
+	int access_flags;
 
 	/* The size
 	 */
@@ -72,6 +133,43 @@ struct libbfio_internal_handle
 	 */
 	libcdata_list_element_t *pool_last_used_list_element;
 
+	/* Value to indicate the pool must not close the handle
+	 * to limit the number of open handles
+	 */
+	uint8_t pool_is_pinned;
+
+	/* Value to indicate the handle was used since the pool
+	 * last considered closing it, used by the CLOCK eviction policy
+	 */
+	uint8_t pool_is_referenced;
+
+	/* Value to indicate the handle is in the frequently used queue
+	 * of the pool, used by the 2Q eviction policy
+	 */
+	uint8_t pool_is_frequently_used;
+
+	/* The number of times the handle was used by the pool,
+	 * used by the LFU eviction policy
+	 */
+	uint32_t pool_number_of_uses;
+
+	/* The pool eviction number when the handle was closed while in the
+	 * recently used queue of the pool, used by the 2Q eviction policy
+	 */
+	uint64_t pool_eviction_number;
+
+	/* The descriptor manager, which is not managed by the handle
+	 */
+	libbfio_descriptor_manager_t *descriptor_manager;
+
+	/* Reference to the descriptor manager last used list element
+	 */
+	libcdata_list_element_t *descriptor_manager_list_element;
+
+	/* The number of users that prevent the descriptor manager from closing the handle
+	 */
+	int descriptor_manager_number_of_users;
+
 	/* Value to indicate to track offsets read
 	 */
 	uint8_t track_offsets_read;
@@ -80,83 +178,111 @@ struct libbfio_internal_handle
 	 */
 	libcdata_range_list_t *offsets_read;
 
+	/* The stages of the offset ranges read that are not yet merged into the offsets read list,
+	 * every thread that reads stages into its own stage without holding the read/write lock
+	 */
+	libbfio_offsets_read_stage_t *offsets_read_stages;
+
+	/* The identifier of the stages, which is unique for every handle
+	 */
+	int64_t offsets_read_stages_identifier;
+
+	/* The block size of the offsets read counts, 0 if not tracked
+	 */
+	size64_t offsets_read_block_size;
+
+	/* The number of times each block was read
+	 */
+	uint32_t *offsets_read_counts;
+
+	/* The number of offsets read counts
+	 */
+	size_t number_of_offsets_read_counts;
+
+	/* The offsets read tracking mode
+	 */
+	int offsets_read_tracking_mode;
+
+	/* The offsets read sampling interval, where only 1 in every interval reads is tracked
+	 */
+	uint32_t offsets_read_sampling_interval;
+
+	/* Value to indicate to read sparse data
+	 */
+	uint8_t sparse_read;
+
+	/* The extents, which are determined on demand
+	 */
+	libcdata_array_t *extents;
+
+	/* Value to indicate the offset of the IO handle
+	 * differs from the current offset
+	 */
+	uint8_t io_handle_offset_is_stale;
+
 	/* The narrow string codepage
 	 */
 	int narrow_string_codepage;
 
-	/* The free IO handle function
+	/* The error mode
 	 */
-	int (*free_io_handle)(
-	       intptr_t **io_handle,
-	       libcerror_error_t **error );
+	int error_mode;
 
-	/* The clone (duplicate) IO handle function
+	/* The error domain of the last failed read
 	 */
-	int (*clone_io_handle)(
-	       intptr_t **destination_io_handle,
-	       intptr_t *source_io_handle,
-	       libcerror_error_t **error );
+	int last_error_domain;
+
+	/* The error code of the last failed read
+	 */
+	int last_error_code;
 
-	/* The open function
+	/* The IO operations that are managed by the handle
+	 * These are used when the handle was created from individual functions
 	 */
-	int (*open)(
+	libbfio_io_operations_t *managed_io_operations;
+
+	/* The get extents function
+	 */
+	int (*get_extents)(
 	       intptr_t *io_handle,
-	       int access_flags,
+	       libcdata_array_t *extents_array,
 	       libcerror_error_t **error );
 
-	/* The close function
+	/* The set access hint function
 	 */
-	int (*close)(
+	int (*set_access_hint)(
 	       intptr_t *io_handle,
+	       int access_hint,
+	       off64_t offset,
+	       size64_t size,
 	       libcerror_error_t **error );
 
-	/* The read function
+	/* The read at offset function, which reads without changing
+	 * the offset of the IO handle
 	 */
-	ssize_t (*read)(
+	ssize_t (*read_at_offset)(
 	           intptr_t *io_handle,
 	           uint8_t *buffer,
 	           size_t size,
-	           libcerror_error_t **error );
-
-	/* The write function
-	 */
-	ssize_t (*write)(
-	           intptr_t *io_handle,
-	           const uint8_t *buffer,
-	           size_t size,
-	           libcerror_error_t **error );
-
-	/* The seek offset function
-	 */
-	off64_t (*seek_offset)(
-	           intptr_t *io_handle,
 	           off64_t offset,
-	           int whence,
 	           libcerror_error_t **error );
 
-	/* The exists function
+	/* The trace callbacks
 	 */
-	int (*exists)(
-	       intptr_t *io_handle,
-	       libcerror_error_t **error );
+	libbfio_trace_t trace;
 
-	/* The is open function
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The read/write lock, which references the embedded lock or is NULL
 	 */
-	int (*is_open)(
-	       intptr_t *io_handle,
-	       libcerror_error_t **error );
+	libbfio_lock_t *read_write_lock;
 
-	/* The get size function
+	/* The embedded lock
 	 */
-	int (*get_size)(
-	       intptr_t *io_handle,
-	       size64_t *size,
-	       libcerror_error_t **error );
+	libbfio_lock_t embedded_lock;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	/* The read/write lock
+	/* The offsets read mutex, which protects the offsets read stages, list and counts
 	 */
-	libcthreads_read_write_lock_t *read_write_lock;
+	libcthreads_mutex_t *offsets_read_mutex;
 #endif
 };
 
@@ -206,6 +332,22 @@ int libbfio_handle_initialize(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_initialize_with_operations(
+     libbfio_handle_t **handle,
+     intptr_t *io_handle,
+     const libbfio_io_operations_t *io_operations,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libbfio_handle_initialize_in_arena(
+     libbfio_handle_t **handle,
+     libbfio_arena_t *arena,
+     intptr_t *io_handle,
+     const libbfio_io_operations_t *io_operations,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_free(
      libbfio_handle_t **handle,
@@ -217,6 +359,40 @@ int libbfio_handle_clone(
      libbfio_handle_t *source_handle,
      libcerror_error_t **error );
 
+int libbfio_internal_handle_io_open(
+     libbfio_internal_handle_t *internal_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_io_close(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_internal_handle_io_read(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_internal_handle_io_read_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libbfio_internal_handle_io_write(
+         libbfio_internal_handle_t *internal_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libbfio_internal_handle_io_seek_offset(
+         libbfio_internal_handle_t *internal_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_open(
      libbfio_handle_t *handle,
@@ -229,17 +405,50 @@ int libbfio_handle_reopen(
      int access_flags,
      libcerror_error_t **error );
 
+int libbfio_internal_handle_close(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_close_if_open(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_close(
      libbfio_handle_t *handle,
      libcerror_error_t **error );
 
+int libbfio_internal_handle_apply_offset_read(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_merge_staged_offsets_read(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_get_offsets_read_stage(
+     libbfio_internal_handle_t *internal_handle,
+     libbfio_offsets_read_stage_t **stage,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_track_offset_read(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
 ssize_t libbfio_internal_handle_read_buffer(
          libbfio_internal_handle_t *internal_handle,
          uint8_t *buffer,
          size_t size,
          libcerror_error_t **error );
 
+int libbfio_internal_handle_release_descriptor(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 ssize_t libbfio_handle_read_buffer(
          libbfio_handle_t *handle,
@@ -255,6 +464,21 @@ ssize_t libbfio_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+ssize_t libbfio_internal_handle_read_buffer_at_offset(
+         libbfio_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint8_t update_current_offset,
+         libcerror_error_t **error );
+
+ssize_t libbfio_handle_positional_read_buffer(
+         libbfio_handle_t *handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 ssize_t libbfio_internal_handle_write_buffer(
          libbfio_internal_handle_t *internal_handle,
          const uint8_t *buffer,
@@ -335,6 +559,12 @@ int libbfio_handle_set_open_on_demand(
      uint8_t open_on_demand,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_set_descriptor_manager(
+     libbfio_handle_t *handle,
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_handle_set_track_offsets_read(
      libbfio_handle_t *handle,
@@ -355,6 +585,204 @@ int libbfio_handle_get_offset_read(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_handle_set_offsets_read_block_size(
+     libbfio_handle_t *handle,
+     size64_t block_size,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_get_ranges_from_read_counts(
+     libbfio_internal_handle_t *internal_handle,
+     uint8_t blocks_read,
+     size64_t handle_size,
+     off64_t *offsets,
+     size64_t *sizes,
+     int maximum_number_of_ranges,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_offsets_read(
+     libbfio_handle_t *handle,
+     off64_t *offsets,
+     size64_t *sizes,
+     int maximum_number_of_ranges,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_offsets_not_read(
+     libbfio_handle_t *handle,
+     off64_t *offsets,
+     size64_t *sizes,
+     int maximum_number_of_ranges,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_offsets_read_heatmap(
+     libbfio_handle_t *handle,
+     uint32_t *read_counts,
+     size_t number_of_blocks,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_offsets_read_tracking_mode(
+     libbfio_handle_t *handle,
+     int tracking_mode,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_offsets_read_sampling_interval(
+     libbfio_handle_t *handle,
+     uint32_t sampling_interval,
+     libcerror_error_t **error );
+
+int libbfio_handle_set_get_extents_function(
+     libbfio_handle_t *handle,
+     int (*get_extents)(
+            intptr_t *io_handle,
+            libcdata_array_t *extents_array,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libbfio_handle_set_access_hint_function(
+     libbfio_handle_t *handle,
+     int (*set_access_hint)(
+            intptr_t *io_handle,
+            int access_hint,
+            off64_t offset,
+            size64_t size,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libbfio_handle_set_read_at_offset_function(
+     libbfio_handle_t *handle,
+     ssize_t (*read_at_offset)(
+                intptr_t *io_handle,
+                uint8_t *buffer,
+                size_t size,
+                off64_t offset,
+                libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_access_hint(
+     libbfio_handle_t *handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_prefetch(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_sparse_read(
+     libbfio_handle_t *handle,
+     uint8_t sparse_read,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_error_mode(
+     libbfio_handle_t *handle,
+     int *error_mode,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_error_mode(
+     libbfio_handle_t *handle,
+     int error_mode,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_last_error(
+     libbfio_handle_t *handle,
+     int *error_domain,
+     int *error_code,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_track_lock_statistics(
+     libbfio_handle_t *handle,
+     uint8_t track_lock_statistics,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_lock_statistics(
+     libbfio_handle_t *handle,
+     uint64_t *number_of_grabs,
+     uint64_t *number_of_contended_grabs,
+     uint64_t *total_wait_time,
+     uint64_t *maximum_wait_time,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_trace_callbacks(
+     libbfio_handle_t *handle,
+     void (*pre_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size ),
+     void (*post_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size,
+            int64_t result,
+            uint64_t duration ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_set_trace_recorder(
+     libbfio_handle_t *handle,
+     libbfio_trace_recorder_t *trace_recorder,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_determine_extents(
+     libbfio_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libbfio_internal_handle_get_extent_at_offset(
+     libbfio_internal_handle_t *internal_handle,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_number_of_extents(
+     libbfio_handle_t *handle,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_extent_by_index(
+     libbfio_handle_t *handle,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_handle_get_extent_at_offset(
+     libbfio_handle_t *handle,
+     off64_t offset,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,162 @@
+/*
+ * Handle range IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_HANDLE_RANGE_IO_HANDLE_H )
+#define _LIBBFIO_HANDLE_RANGE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_handle_range_io_handle libbfio_handle_range_io_handle_t;
+
+struct libbfio_handle_range_io_handle
+{
+	/* The parent handle, which is not managed by the handle range IO handle
+	 */
+	libbfio_handle_t *parent_handle;
+
+	/* The range (start) offset
+	 */
+	off64_t range_offset;
+
+	/* The range size
+	 */
+	size64_t range_size;
+
+	/* The size of the range as determined on open
+	 */
+	size64_t size;
+
+	/* The current offset in the range
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the handle range is open
+	 */
+	uint8_t is_open;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libbfio_handle_range_io_handle_initialize(
+     libbfio_handle_range_io_handle_t **handle_range_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_free(
+     libbfio_handle_range_io_handle_t **handle_range_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_clone(
+     libbfio_handle_range_io_handle_t **destination_handle_range_io_handle,
+     libbfio_handle_range_io_handle_t *source_handle_range_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_get_parent_handle(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libbfio_handle_t **parent_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_set_parent_handle(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libbfio_handle_t *parent_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_get(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_set(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_open(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_close(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_handle_range_io_handle_read_buffer(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_handle_range_io_handle_read_buffer_at_offset(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libbfio_handle_range_io_handle_write_buffer(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libbfio_handle_range_io_handle_seek_offset(
+         libbfio_handle_range_io_handle_t *handle_range_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_exists(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_is_open(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_get_size(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libbfio_handle_range_io_handle_set_access_hint(
+     libbfio_handle_range_io_handle_t *handle_range_io_handle,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_HANDLE_RANGE_IO_HANDLE_H ) */
+
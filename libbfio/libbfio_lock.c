@@ -0,0 +1,1051 @@
+/*
+ * Lock functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_LIMITS_H ) || defined( WINAPI )
+#include <limits.h>
+#endif
+
+#include "libbfio_atomic.h"
+#include "libbfio_definitions.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_lock.h"
+#include "libbfio_timestamp.h"
+#include "libbfio_unused.h"
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+#if defined( __linux__ )
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#define HAVE_LIBBFIO_LOCK_FUTEX		1
+
+#elif !defined( WINAPI )
+#include <sched.h>
+
+#endif /* defined( __linux__ ) */
+#endif /* defined( HAVE_LIBBFIO_SPIN_LOCK ) */
+
+/* The lock type used by newly created handles and pools
+ */
+static int libbfio_lock_default_type = LIBBFIO_DEFAULT_LOCK_TYPE;
+
+/* Retrieves the lock type used by newly created handles and pools
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_get_default_type(
+     int *lock_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_get_default_type";
+
+	if( lock_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock type.",
+		 function );
+
+		return( -1 );
+	}
+	*lock_type = (int) libbfio_atomic_load_int32(
+	                    &libbfio_lock_default_type );
+
+	return( 1 );
+}
+
+/* Sets the lock type used by newly created handles and pools
+ * Existing handles and pools keep the lock type they were created with
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_set_default_type(
+     int lock_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_set_default_type";
+
+	if( ( lock_type != LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK )
+	 && ( lock_type != LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported lock type.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBBFIO_SPIN_LOCK )
+	if( lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: spin then park lock type not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	libbfio_atomic_store_int32(
+	 &libbfio_lock_default_type,
+	 lock_type );
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+
+/* Hints the processor that the thread is spinning
+ */
+#if defined( __i386__ ) || defined( __x86_64__ )
+#define libbfio_lock_spin_pause() \
+	__builtin_ia32_pause()
+
+#elif defined( __aarch64__ ) || defined( __arm__ )
+#define libbfio_lock_spin_pause() \
+	__asm__ __volatile__( "yield" ::: "memory" )
+
+#else
+#define libbfio_lock_spin_pause() \
+	/* empty */
+
+#endif /* defined( __i386__ ) || defined( __x86_64__ ) */
+
+/* Tries to grab the spin then park lock for reading
+ * Writers are preferred, hence new readers are held back while a writer is waiting
+ * Returns 1 if successful or 0 if the lock is held or waited for by a writer
+ */
+static int libbfio_lock_spin_try_grab_for_read(
+            libbfio_lock_t *lock )
+{
+	uint32_t state = 0;
+
+	if( __atomic_load_n(
+	     &( lock->number_of_waiting_writers ),
+	     __ATOMIC_SEQ_CST ) != 0 )
+	{
+		return( 0 );
+	}
+	state = __atomic_load_n(
+	         &( lock->state ),
+	         __ATOMIC_SEQ_CST );
+
+	while( ( state & LIBBFIO_LOCK_STATE_FLAG_WRITER ) == 0 )
+	{
+		/* On failure state is updated with the current value
+		 */
+		if( __atomic_compare_exchange_n(
+		     &( lock->state ),
+		     &state,
+		     state + 1,
+		     0,
+		     __ATOMIC_SEQ_CST,
+		     __ATOMIC_SEQ_CST ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Tries to grab the spin then park lock for writing
+ * Returns 1 if successful or 0 if the lock is held
+ */
+static int libbfio_lock_spin_try_grab_for_write(
+            libbfio_lock_t *lock )
+{
+	uint32_t state = 0;
+
+	if( __atomic_compare_exchange_n(
+	     &( lock->state ),
+	     &state,
+	     (uint32_t) LIBBFIO_LOCK_STATE_FLAG_WRITER,
+	     0,
+	     __ATOMIC_SEQ_CST,
+	     __ATOMIC_SEQ_CST ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Parks the thread until the wake sequence differs from the one provided
+ * A spurious return is allowed since the caller retries grabbing the lock
+ */
+static void libbfio_lock_spin_park(
+             libbfio_lock_t *lock,
+             uint32_t wake_sequence )
+{
+#if defined( HAVE_LIBBFIO_LOCK_FUTEX )
+	syscall(
+	 SYS_futex,
+	 &( lock->wake_sequence ),
+	 FUTEX_WAIT_PRIVATE,
+	 wake_sequence,
+	 NULL,
+	 NULL,
+	 0 );
+
+#elif defined( WINAPI )
+	LIBBFIO_UNREFERENCED_PARAMETER( lock )
+	LIBBFIO_UNREFERENCED_PARAMETER( wake_sequence )
+
+	SwitchToThread();
+
+#else
+	LIBBFIO_UNREFERENCED_PARAMETER( lock )
+	LIBBFIO_UNREFERENCED_PARAMETER( wake_sequence )
+
+	sched_yield();
+
+#endif /* defined( HAVE_LIBBFIO_LOCK_FUTEX ) */
+}
+
+/* Wakes the threads parked on the spin then park lock if any
+ */
+static void libbfio_lock_spin_wake(
+             libbfio_lock_t *lock )
+{
+	if( __atomic_load_n(
+	     &( lock->number_of_parked_threads ),
+	     __ATOMIC_SEQ_CST ) == 0 )
+	{
+		return;
+	}
+	__atomic_add_fetch(
+	 &( lock->wake_sequence ),
+	 1,
+	 __ATOMIC_SEQ_CST );
+
+#if defined( HAVE_LIBBFIO_LOCK_FUTEX )
+	syscall(
+	 SYS_futex,
+	 &( lock->wake_sequence ),
+	 FUTEX_WAKE_PRIVATE,
+	 INT_MAX,
+	 NULL,
+	 NULL,
+	 0 );
+#endif
+}
+
+/* Grabs the spin then park lock
+ * The lock is tried a limited number of times before the thread is parked,
+ * the thread registers itself as parked before the final try so that
+ * a release in between either is observed by the try or wakes the thread
+ * Returns 1 if the lock was contended or 0 if not
+ */
+static int libbfio_lock_spin_grab(
+            libbfio_lock_t *lock,
+            int (*try_grab)(
+                   libbfio_lock_t *lock ) )
+{
+	uint32_t wake_sequence = 0;
+	int number_of_spins    = 0;
+
+	for( number_of_spins = 0;
+	     number_of_spins < LIBBFIO_LOCK_MAXIMUM_NUMBER_OF_SPINS;
+	     number_of_spins++ )
+	{
+		if( try_grab(
+		     lock ) != 0 )
+		{
+			return( number_of_spins > 0 );
+		}
+		libbfio_lock_spin_pause();
+	}
+	for( ;; )
+	{
+		wake_sequence = __atomic_load_n(
+		                 &( lock->wake_sequence ),
+		                 __ATOMIC_SEQ_CST );
+
+		__atomic_add_fetch(
+		 &( lock->number_of_parked_threads ),
+		 1,
+		 __ATOMIC_SEQ_CST );
+
+		if( try_grab(
+		     lock ) != 0 )
+		{
+			__atomic_sub_fetch(
+			 &( lock->number_of_parked_threads ),
+			 1,
+			 __ATOMIC_SEQ_CST );
+
+			return( 1 );
+		}
+		libbfio_lock_spin_park(
+		 lock,
+		 wake_sequence );
+
+		__atomic_sub_fetch(
+		 &( lock->number_of_parked_threads ),
+		 1,
+		 __ATOMIC_SEQ_CST );
+
+		if( try_grab(
+		     lock ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+}
+
+/* Grabs the spin then park lock for writing
+ * A writer that cannot grab the lock right away registers itself as waiting,
+ * so that readers cannot keep the lock held indefinitely
+ * Returns 1 if the lock was contended or 0 if not
+ */
+static int libbfio_lock_spin_grab_for_write(
+            libbfio_lock_t *lock )
+{
+	if( libbfio_lock_spin_try_grab_for_write(
+	     lock ) != 0 )
+	{
+		return( 0 );
+	}
+	__atomic_add_fetch(
+	 &( lock->number_of_waiting_writers ),
+	 1,
+	 __ATOMIC_SEQ_CST );
+
+	libbfio_lock_spin_grab(
+	 lock,
+	 &libbfio_lock_spin_try_grab_for_write );
+
+	/* Readers that were held back are woken up when the lock is released for writing
+	 */
+	__atomic_sub_fetch(
+	 &( lock->number_of_waiting_writers ),
+	 1,
+	 __ATOMIC_SEQ_CST );
+
+	return( 1 );
+}
+
+/* Updates the lock statistics after the lock was grabbed
+ */
+static void libbfio_lock_update_statistics(
+             libbfio_lock_t *lock,
+             uint64_t start_timestamp,
+             int is_contended )
+{
+	uint64_t maximum_wait_time = 0;
+	uint64_t wait_time         = 0;
+
+	wait_time = libbfio_timestamp_get_monotonic();
+
+	if( wait_time > start_timestamp )
+	{
+		wait_time -= start_timestamp;
+	}
+	else
+	{
+		wait_time = 0;
+	}
+	if( wait_time >= LIBBFIO_LOCK_CONTENDED_WAIT_TIME )
+	{
+		is_contended = 1;
+	}
+	__atomic_add_fetch(
+	 &( lock->number_of_grabs ),
+	 1,
+	 __ATOMIC_RELAXED );
+
+	if( is_contended != 0 )
+	{
+		__atomic_add_fetch(
+		 &( lock->number_of_contended_grabs ),
+		 1,
+		 __ATOMIC_RELAXED );
+	}
+	__atomic_add_fetch(
+	 &( lock->total_wait_time ),
+	 wait_time,
+	 __ATOMIC_RELAXED );
+
+	maximum_wait_time = __atomic_load_n(
+	                     &( lock->maximum_wait_time ),
+	                     __ATOMIC_RELAXED );
+
+	/* On failure maximum wait time is updated with the current value
+	 */
+	while( ( wait_time > maximum_wait_time )
+	    && ( __atomic_compare_exchange_n(
+	          &( lock->maximum_wait_time ),
+	          &maximum_wait_time,
+	          wait_time,
+	          0,
+	          __ATOMIC_RELAXED,
+	          __ATOMIC_RELAXED ) == 0 ) )
+	{
+	}
+}
+
+#endif /* defined( HAVE_LIBBFIO_SPIN_LOCK ) */
+
+/* Creates a lock of the default lock type
+ * Make sure the value lock is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_initialize(
+     libbfio_lock_t **lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_initialize";
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*lock = memory_allocate_structure(
+	         libbfio_lock_t );
+
+	if( *lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_lock_initialize_embedded(
+	     *lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize lock.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *lock != NULL )
+	{
+		memory_free(
+		 *lock );
+
+		*lock = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a lock
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_free(
+     libbfio_lock_t **lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_free";
+	int result            = 1;
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lock != NULL )
+	{
+		if( libbfio_lock_finalize_embedded(
+		     *lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize lock.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *lock );
+
+		*lock = NULL;
+	}
+	return( result );
+}
+
+/* Initializes a lock of the default lock type that is embedded in another structure
+ * The spin then park lock is then contained in the structure itself, hence
+ * grabbing it does not dereference a separately allocated lock
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_initialize_embedded(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_initialize_embedded";
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     lock,
+	     0,
+	     sizeof( libbfio_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lock.",
+		 function );
+
+		return( -1 );
+	}
+	lock->lock_type = (int) libbfio_atomic_load_int32(
+	                         &libbfio_lock_default_type );
+
+	if( lock->lock_type == LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK )
+	{
+		if( libcthreads_read_write_lock_initialize(
+		     &( lock->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize read/write lock.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes a lock that is embedded in another structure
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_finalize_embedded(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_finalize_embedded";
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( lock->read_write_lock != NULL )
+	{
+		if( libcthreads_read_write_lock_free(
+		     &( lock->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets if the lock statistics should be tracked
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_set_track_statistics(
+     libbfio_lock_t *lock,
+     uint8_t track_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_set_track_statistics";
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	__atomic_store_n(
+	 &( lock->track_statistics ),
+	 ( track_statistics != 0 ) ? 1 : 0,
+	 __ATOMIC_RELAXED );
+
+#else
+	if( track_statistics != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: lock statistics not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBBFIO_SPIN_LOCK ) */
+
+	return( 1 );
+}
+
+/* Retrieves the lock statistics
+ * The wait times are in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_get_statistics(
+     libbfio_lock_t *lock,
+     uint64_t *number_of_grabs,
+     uint64_t *number_of_contended_grabs,
+     uint64_t *total_wait_time,
+     uint64_t *maximum_wait_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_get_statistics";
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_grabs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of grabs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_contended_grabs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of contended grabs.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_wait_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total wait time.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_wait_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum wait time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	*number_of_grabs = __atomic_load_n(
+	                    &( lock->number_of_grabs ),
+	                    __ATOMIC_RELAXED );
+
+	*number_of_contended_grabs = __atomic_load_n(
+	                              &( lock->number_of_contended_grabs ),
+	                              __ATOMIC_RELAXED );
+
+	*total_wait_time = __atomic_load_n(
+	                    &( lock->total_wait_time ),
+	                    __ATOMIC_RELAXED );
+
+	*maximum_wait_time = __atomic_load_n(
+	                      &( lock->maximum_wait_time ),
+	                      __ATOMIC_RELAXED );
+#else
+	*number_of_grabs           = 0;
+	*number_of_contended_grabs = 0;
+	*total_wait_time           = 0;
+	*maximum_wait_time         = 0;
+#endif
+	return( 1 );
+}
+
+/* Grabs a lock for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_grab_for_read(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error )
+{
+	static char *function    = "libbfio_lock_grab_for_read";
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	uint64_t start_timestamp = 0;
+	uint8_t track_statistics = 0;
+	int is_contended         = 0;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	track_statistics = __atomic_load_n(
+	                    &( lock->track_statistics ),
+	                    __ATOMIC_RELAXED );
+
+	if( track_statistics != 0 )
+	{
+		start_timestamp = libbfio_timestamp_get_monotonic();
+	}
+	if( lock->lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK )
+	{
+		is_contended = libbfio_lock_spin_grab(
+		                lock,
+		                &libbfio_lock_spin_try_grab_for_read );
+	}
+	else
+#endif
+	if( libcthreads_read_write_lock_grab_for_read(
+	     lock->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	if( track_statistics != 0 )
+	{
+		libbfio_lock_update_statistics(
+		 lock,
+		 start_timestamp,
+		 is_contended );
+	}
+#endif
+	return( 1 );
+}
+
+/* Grabs a lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_grab_for_write(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error )
+{
+	static char *function    = "libbfio_lock_grab_for_write";
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	uint64_t start_timestamp = 0;
+	uint8_t track_statistics = 0;
+	int is_contended         = 0;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	track_statistics = __atomic_load_n(
+	                    &( lock->track_statistics ),
+	                    __ATOMIC_RELAXED );
+
+	if( track_statistics != 0 )
+	{
+		start_timestamp = libbfio_timestamp_get_monotonic();
+	}
+	if( lock->lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK )
+	{
+		is_contended = libbfio_lock_spin_grab_for_write(
+		                lock );
+	}
+	else
+#endif
+	if( libcthreads_read_write_lock_grab_for_write(
+	     lock->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	if( track_statistics != 0 )
+	{
+		libbfio_lock_update_statistics(
+		 lock,
+		 start_timestamp,
+		 is_contended );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a lock for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_release_for_read(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_release_for_read";
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	uint32_t state        = 0;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	if( lock->lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK )
+	{
+		state = __atomic_load_n(
+		         &( lock->state ),
+		         __ATOMIC_SEQ_CST );
+
+		do
+		{
+			if( ( ( state & LIBBFIO_LOCK_STATE_FLAG_WRITER ) != 0 )
+			 || ( state == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid lock - not held for reading.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		while( __atomic_compare_exchange_n(
+		        &( lock->state ),
+		        &state,
+		        state - 1,
+		        0,
+		        __ATOMIC_SEQ_CST,
+		        __ATOMIC_SEQ_CST ) == 0 );
+
+		if( state == 1 )
+		{
+			libbfio_lock_spin_wake(
+			 lock );
+		}
+		return( 1 );
+	}
+#endif
+	if( libcthreads_read_write_lock_release_for_read(
+	     lock->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases a lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_lock_release_for_write(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_lock_release_for_write";
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	uint32_t state        = 0;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	if( lock->lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK )
+	{
+		state = (uint32_t) LIBBFIO_LOCK_STATE_FLAG_WRITER;
+
+		if( __atomic_compare_exchange_n(
+		     &( lock->state ),
+		     &state,
+		     0,
+		     0,
+		     __ATOMIC_SEQ_CST,
+		     __ATOMIC_SEQ_CST ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid lock - not held for writing.",
+			 function );
+
+			return( -1 );
+		}
+		libbfio_lock_spin_wake(
+		 lock );
+
+		return( 1 );
+	}
+#endif
+	if( libcthreads_read_write_lock_release_for_write(
+	     lock->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
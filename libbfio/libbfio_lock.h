@@ -0,0 +1,174 @@
+/*
+ * Lock functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_LOCK_H )
+#define _LIBBFIO_LOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_definitions.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The spin then park lock requires compiler atomics
+ */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) && defined( __ATOMIC_SEQ_CST )
+#define HAVE_LIBBFIO_SPIN_LOCK		1
+#endif
+
+/* The lock type used when none was set at run time, this can be overridden
+ * at build time e.g. with -DLIBBFIO_DEFAULT_LOCK_TYPE=LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK
+ */
+#if !defined( LIBBFIO_DEFAULT_LOCK_TYPE )
+#define LIBBFIO_DEFAULT_LOCK_TYPE	LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK
+#endif
+
+/* The number of times the spin then park lock is tried before the thread is parked
+ */
+#define LIBBFIO_LOCK_MAXIMUM_NUMBER_OF_SPINS	128
+
+/* The minimum wait time in nano seconds for which a grab of a read/write lock
+ * is considered contended, since it cannot be tried without blocking
+ */
+#define LIBBFIO_LOCK_CONTENDED_WAIT_TIME	1000
+
+/* The spin then park lock state flag that indicates the lock is held for writing,
+ * the lower bits contain the number of readers
+ */
+#define LIBBFIO_LOCK_STATE_FLAG_WRITER		0x80000000UL
+
+int libbfio_lock_get_default_type(
+     int *lock_type,
+     libcerror_error_t **error );
+
+int libbfio_lock_set_default_type(
+     int lock_type,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+typedef struct libbfio_lock libbfio_lock_t;
+
+struct libbfio_lock
+{
+	/* The lock type
+	 */
+	int lock_type;
+
+	/* The read/write lock, used by the read/write lock type
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The state, used by the spin then park lock type
+	 */
+	uint32_t state;
+
+	/* The wake sequence, parked threads wait for it to change
+	 */
+	uint32_t wake_sequence;
+
+	/* The number of parked threads
+	 */
+	uint32_t number_of_parked_threads;
+
+	/* The number of writers waiting for the lock, while non-zero new readers are held back
+	 */
+	uint32_t number_of_waiting_writers;
+
+	/* Value to indicate if the lock statistics should be tracked
+	 */
+	uint8_t track_statistics;
+
+	/* The number of grabs
+	 */
+	uint64_t number_of_grabs;
+
+	/* The number of grabs that had to wait for the lock
+	 */
+	uint64_t number_of_contended_grabs;
+
+	/* The total time in nano seconds spent waiting for the lock
+	 */
+	uint64_t total_wait_time;
+
+	/* The maximum time in nano seconds spent waiting for the lock
+	 */
+	uint64_t maximum_wait_time;
+};
+
+int libbfio_lock_initialize(
+     libbfio_lock_t **lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_free(
+     libbfio_lock_t **lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_initialize_embedded(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_finalize_embedded(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_set_track_statistics(
+     libbfio_lock_t *lock,
+     uint8_t track_statistics,
+     libcerror_error_t **error );
+
+int libbfio_lock_get_statistics(
+     libbfio_lock_t *lock,
+     uint64_t *number_of_grabs,
+     uint64_t *number_of_contended_grabs,
+     uint64_t *total_wait_time,
+     uint64_t *maximum_wait_time,
+     libcerror_error_t **error );
+
+int libbfio_lock_grab_for_read(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_grab_for_write(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_release_for_read(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error );
+
+int libbfio_lock_release_for_write(
+     libbfio_lock_t *lock,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_LOCK_H ) */
+
@@ -29,11 +29,27 @@
 
 #include "libbfio_definitions.h"
 #include "libbfio_handle.h"
+#include "libbfio_io_operations.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_memory_range.h"
 #include "libbfio_memory_range_io_handle.h"
 #include "libbfio_types.h"
 
+/* The memory range IO operations
+ */
+static const libbfio_io_operations_t libbfio_memory_range_io_operations = {
+	(int (*)(intptr_t **, libcerror_error_t **)) libbfio_memory_range_io_handle_free,
+	(int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_clone,
+	(int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_memory_range_io_handle_open,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_close,
+	(ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_memory_range_io_handle_read_buffer,
+	(ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_memory_range_io_handle_write_buffer,
+	(off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_memory_range_io_handle_seek_offset,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_exists,
+	(int (*)(intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_is_open,
+	(int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_get_size
+};
+
 /* Creates a memory range handle
  * Make sure the value handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -80,19 +96,10 @@ int libbfio_memory_range_initialize(
 
 		goto on_error;
 	}
-	if( libbfio_handle_initialize(
+	if( libbfio_handle_initialize_with_operations(
 	     handle,
 	     (intptr_t *) memory_range_io_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) libbfio_memory_range_io_handle_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_clone,
-	     (int (*)(intptr_t *, int, libcerror_error_t **)) libbfio_memory_range_io_handle_open,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_close,
-	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libbfio_memory_range_io_handle_read_buffer,
-	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libbfio_memory_range_io_handle_write_buffer,
-	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libbfio_memory_range_io_handle_seek_offset,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_exists,
-	     (int (*)(intptr_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_is_open,
-	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libbfio_memory_range_io_handle_get_size,
+	     &libbfio_memory_range_io_operations,
 	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
 	     error ) != 1 )
 	{
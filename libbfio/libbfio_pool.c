@@ -27,12 +27,17 @@
 #include <unistd.h>
 #endif
 
+#include "libbfio_arena.h"
+#include "libbfio_atomic.h"
 #include "libbfio_definitions.h"
+#include "libbfio_descriptor_manager.h"
 #include "libbfio_handle.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_pool.h"
+#include "libbfio_trace_recorder.h"
 #include "libbfio_types.h"
+#include "libbfio_unused.h"
 
 /* Creates a pool
  * Make sure the value pool is referencing, is set to NULL
@@ -150,8 +155,8 @@ int libbfio_pool_initialize(
 		goto on_error;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_pool->read_write_lock ),
+	if( libbfio_lock_initialize_embedded(
+	     &( internal_pool->embedded_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -163,6 +168,7 @@ int libbfio_pool_initialize(
 
 		goto on_error;
 	}
+	internal_pool->read_write_lock = &( internal_pool->embedded_lock );
 #endif
 	internal_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
 	internal_pool->current_entry                  = -1;
@@ -194,6 +200,60 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a pool that allocates the handles it creates from an arena
+ * The arena consists of a small number of large slabs, which are freed
+ * together with the pool, hence handles created by the pool must not be
+ * used after the pool has been freed
+ * Make sure the value pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_initialize_with_arena(
+     libbfio_pool_t **pool,
+     int number_of_handles,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_initialize_with_arena";
+
+	if( libbfio_pool_initialize(
+	     pool,
+	     number_of_handles,
+	     maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) *pool;
+
+	if( libbfio_arena_initialize(
+	     &( internal_pool->arena ),
+	     LIBBFIO_ARENA_DEFAULT_SLAB_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		libbfio_pool_free(
+		 pool,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Frees a pool
  * Returns 1 if successful or -1 on error
  */
@@ -222,8 +282,69 @@ int libbfio_pool_free(
 		*pool         = NULL;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-		if( libcthreads_read_write_lock_free(
-		     &( internal_pool->read_write_lock ),
+		if( libbfio_internal_pool_wait_for_pre_open(
+		     internal_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to wait for pre-open.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_pool->pre_open_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( internal_pool->pre_open_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join pre-open thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_pool->pre_open_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( internal_pool->pre_open_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pre-open condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_pool->pre_open_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( internal_pool->pre_open_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pre-open mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libbfio_lock_finalize_embedded(
+		     internal_pool->read_write_lock,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -235,6 +356,7 @@ int libbfio_pool_free(
 
 			result = -1;
 		}
+		internal_pool->read_write_lock = NULL;
 #endif
 		if( libcdata_array_free(
 		     &( internal_pool->handles_array ),
@@ -264,12 +386,230 @@ int libbfio_pool_free(
 
 			result = -1;
 		}
+		/* The arena is freed after the handles that were allocated from it
+		 */
+		if( internal_pool->arena != NULL )
+		{
+			if( libbfio_arena_free(
+			     &( internal_pool->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_pool );
 	}
 	return( result );
 }
 
+/* Frees a pool
+ * If number of threads is larger than 0 and multi-thread support is available
+ * the handles are closed and freed in parallel
+ * Handles allocated from the arena of the pool are released together with the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_free_parallel(
+     libbfio_pool_t **pool,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_close_value_t *close_values = NULL;
+	libbfio_internal_pool_t *internal_pool            = NULL;
+	static char *function                             = "libbfio_pool_free_parallel";
+	size_t close_values_size                          = 0;
+	int entry                                         = 0;
+	int number_of_handles                             = 0;
+	int result                                        = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool == NULL )
+	{
+		return( 1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) *pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == 1 )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_pool->handles_array,
+		     &number_of_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of handles.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( number_of_handles > 0 ) )
+	{
+		close_values_size = sizeof( libbfio_internal_pool_close_value_t ) * number_of_handles;
+
+		if( close_values_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid close values size value exceeds maximum.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			close_values = (libbfio_internal_pool_close_value_t *) memory_allocate(
+			                                                        close_values_size );
+
+			if( close_values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create close values.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( close_values != NULL )
+	{
+		/* The handles are removed from the handles array so that they are not freed twice
+		 */
+		for( entry = 0;
+		     entry < number_of_handles;
+		     entry++ )
+		{
+			close_values[ entry ].handle = NULL;
+			close_values[ entry ].result = 1;
+
+			if( libcdata_array_get_entry_by_index(
+			     internal_pool->handles_array,
+			     entry,
+			     (intptr_t **) &( close_values[ entry ].handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve handle: %d.",
+				 function,
+				 entry );
+
+				result = -1;
+
+				break;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     internal_pool->handles_array,
+			     entry,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set handle: %d.",
+				 function,
+				 entry );
+
+				close_values[ entry ].handle = NULL;
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( libbfio_internal_pool_process_close_values(
+		     close_values,
+		     entry,
+		     number_of_threads,
+		     &libbfio_internal_pool_free_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free handles.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 close_values );
+	}
+	/* The handles that remain in the handles array are freed by libbfio_pool_free
+	 */
+	if( libbfio_pool_free(
+	     pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free pool.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Clones (duplicates) the pool
  * The values in the offsets read list are not duplicated
  * Returns 1 if successful or -1 on error
@@ -279,9 +619,12 @@ int libbfio_pool_clone(
      libbfio_pool_t *source_pool,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *handle                           = NULL;
 	libbfio_internal_pool_t *internal_destination_pool = NULL;
 	libbfio_internal_pool_t *internal_source_pool      = NULL;
 	static char *function                              = "libbfio_pool_clone";
+	int entry                                          = 0;
+	int number_of_handles                              = 0;
 
 	if( destination_pool == NULL )
 	{
@@ -314,7 +657,7 @@ int libbfio_pool_clone(
 	internal_source_pool = (libbfio_internal_pool_t *) source_pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libbfio_lock_grab_for_read(
 	     internal_source_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -394,8 +737,8 @@ int libbfio_pool_clone(
 		goto on_error;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_destination_pool->read_write_lock ),
+	if( libbfio_lock_initialize_embedded(
+	     &( internal_destination_pool->embedded_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -407,40 +750,103 @@ int libbfio_pool_clone(
 
 		goto on_error;
 	}
+	internal_destination_pool->read_write_lock = &( internal_destination_pool->embedded_lock );
 #endif
-	internal_destination_pool->maximum_number_of_open_handles = internal_source_pool->maximum_number_of_open_handles;
+	internal_destination_pool->maximum_number_of_open_handles          = internal_source_pool->maximum_number_of_open_handles;
+	internal_destination_pool->adaptive_maximum_number_of_open_handles = internal_source_pool->adaptive_maximum_number_of_open_handles;
+	internal_destination_pool->eviction_policy                         = internal_source_pool->eviction_policy;
+	internal_destination_pool->error_mode                              = internal_source_pool->error_mode;
+	internal_destination_pool->descriptor_manager                      = internal_source_pool->descriptor_manager;
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_source_pool->read_write_lock,
-	     error ) != 1 )
+	if( internal_destination_pool->descriptor_manager != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		libbfio_pool_free(
-		 (libbfio_pool_t **) &internal_destination_pool,
-		 NULL );
-
-		return( -1 );
-	}
-#endif
-	*destination_pool = (libbfio_pool_t *) internal_destination_pool;
-
-	return( 1 );
+		if( libcdata_array_get_number_of_entries(
+		     internal_destination_pool->handles_array,
+		     &number_of_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of handles.",
+			 function );
 
-on_error:
-	if( internal_destination_pool != NULL )
-	{
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-		if( internal_destination_pool->read_write_lock != NULL )
+			goto on_error;
+		}
+		for( entry = 0;
+		     entry < number_of_handles;
+		     entry++ )
 		{
-			libcthreads_read_write_lock_free(
-			 &( internal_destination_pool->read_write_lock ),
+			if( libcdata_array_get_entry_by_index(
+			     internal_destination_pool->handles_array,
+			     entry,
+			     (intptr_t **) &handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve handle: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+			if( handle == NULL )
+			{
+				continue;
+			}
+			if( libbfio_internal_pool_set_handle_descriptor_manager(
+			     internal_destination_pool,
+			     handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set descriptor manager of handle: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+		}
+	}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_read(
+	     internal_source_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libbfio_pool_free(
+		 (libbfio_pool_t **) &internal_destination_pool,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	*destination_pool = (libbfio_pool_t *) internal_destination_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_destination_pool != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( internal_destination_pool->read_write_lock != NULL )
+		{
+			libbfio_lock_finalize_embedded(
+			 internal_destination_pool->read_write_lock,
 			 NULL );
 		}
 #endif
@@ -462,7 +868,7 @@ on_error:
 		 internal_destination_pool );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_read(
+	libbfio_lock_release_for_read(
 	 internal_source_pool->read_write_lock,
 	 NULL );
 #endif
@@ -495,7 +901,7 @@ int libbfio_pool_resize(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -508,6 +914,23 @@ int libbfio_pool_resize(
 
 		return( -1 );
 	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
 #endif
 	if( libcdata_array_resize(
 	     internal_pool->handles_array,
@@ -525,7 +948,7 @@ int libbfio_pool_resize(
 		result = -1;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -547,6 +970,7 @@ int libbfio_pool_resize(
  */
 int libbfio_internal_pool_open_handle(
      libbfio_internal_pool_t *internal_pool,
+     int entry,
      libbfio_handle_t *handle,
      int access_flags,
      libcerror_error_t **error )
@@ -554,6 +978,8 @@ int libbfio_internal_pool_open_handle(
 	libbfio_internal_handle_t *internal_handle = NULL;
 	static char *function                      = "libbfio_internal_pool_open_handle";
 	int is_open                                = 0;
+	int result                                 = 1;
+	uint64_t start_timestamp                   = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -624,10 +1050,74 @@ int libbfio_internal_pool_open_handle(
 			return( -1 );
 		}
 	}
-	if( libbfio_handle_open(
-	     handle,
-	     access_flags,
-	     error ) != 1 )
+	else if( internal_pool->descriptor_manager != NULL )
+	{
+		/* Acquiring the handle closes the least recently used handles
+		 * of the descriptor manager if necessary
+		 */
+		if( libbfio_descriptor_manager_acquire_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to acquire handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_pool->trace.is_enabled != 0 )
+	{
+		start_timestamp = libbfio_trace_begin(
+		                   &( internal_pool->trace ),
+		                   LIBBFIO_TRACE_OPERATION_OPEN,
+		                   entry,
+		                   0,
+		                   0 );
+	}
+	result = libbfio_handle_open(
+	          handle,
+	          access_flags,
+	          error );
+
+	if( ( result != 1 )
+	 && ( internal_pool->adaptive_maximum_number_of_open_handles != 0 ) )
+	{
+		/* The process can have run out of descriptors, hence decrease
+		 * the maximum number of open handles and try again
+		 */
+		result = libbfio_internal_pool_decrease_maximum_number_of_open_handles(
+		          internal_pool,
+		          handle,
+		          NULL );
+
+		if( result == 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			result = libbfio_handle_open(
+			          handle,
+			          access_flags,
+			          error );
+		}
+	}
+	if( internal_pool->trace.is_enabled != 0 )
+	{
+		libbfio_trace_end(
+		 &( internal_pool->trace ),
+		 LIBBFIO_TRACE_OPERATION_OPEN,
+		 entry,
+		 0,
+		 0,
+		 (int64_t) result,
+		 start_timestamp );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -636,30 +1126,151 @@ int libbfio_internal_pool_open_handle(
 		 "%s: unable to open handle.",
 		 function );
 
-		return( -1 );
+		internal_pool->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+		internal_pool->last_error_code   = LIBCERROR_IO_ERROR_OPEN_FAILED;
+
+		result = -1;
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
+	if( result == 1 )
+	{
+		internal_handle = (libbfio_internal_handle_t *) handle;
+
+		if( libbfio_handle_seek_offset(
+		     handle,
+		     internal_handle->current_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_pool->descriptor_manager != NULL )
+	{
+		if( result != 1 )
+		{
+			libbfio_descriptor_manager_remove_handle(
+			 internal_pool->descriptor_manager,
+			 handle,
+			 NULL );
+		}
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle from descriptor manager.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the descriptor manager of the pool in a handle
+ * An open handle is accounted for by the descriptor manager
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_set_handle_descriptor_manager(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_pool_set_handle_descriptor_manager";
+	int is_open           = 0;
 
-	if( libbfio_handle_seek_offset(
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_set_descriptor_manager(
 	     handle,
-	     internal_handle->current_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	     internal_pool->descriptor_manager,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set descriptor manager in handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->descriptor_manager == NULL )
+	{
+		return( 1 );
+	}
+	is_open = libbfio_handle_is_open(
+	           handle,
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle is open.",
 		 function );
 
 		return( -1 );
 	}
+	else if( is_open != 0 )
+	{
+		if( libbfio_descriptor_manager_acquire_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to acquire handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle from descriptor manager.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
 /* Appends the handle to the last used list
- * Closes the less frequently used handle if necessary
+ * Closes the handle determined by the eviction policy if necessary
  * Returns 1 if successful or -1 on error
  */
 int libbfio_internal_pool_append_handle_to_last_used_list(
@@ -671,6 +1282,8 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 	libcdata_list_element_t *last_used_list_element      = NULL;
 	libcdata_list_element_t *safe_last_used_list_element = NULL;
 	static char *function                                = "libbfio_internal_pool_append_handle_to_last_used_list";
+	int maximum_number_of_evictions                      = 0;
+	int result                                           = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -710,16 +1323,20 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 	if( ( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
 	 && ( ( internal_pool->number_of_open_handles + 1 ) >= internal_pool->maximum_number_of_open_handles ) )
 	{
-		if( libcdata_list_get_last_element(
-		     internal_pool->last_used_list,
-		     &last_used_list_element,
-		     error ) != 1 )
+		/* If all the open handles are pinned the maximum is exceeded
+		 */
+		result = libbfio_internal_pool_get_eviction_list_element(
+		          internal_pool,
+		          &last_used_list_element,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last list element from last used list.",
+			 "%s: unable to retrieve eviction list element from last used list.",
 			 function );
 
 			goto on_error;
@@ -782,9 +1399,10 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 
 		if( internal_handle != NULL )
 		{
-			if( libbfio_handle_close(
+			if( libbfio_internal_pool_close_evicted_handle(
+			     internal_pool,
 			     (libbfio_handle_t *) internal_handle,
-			     error ) != 0 )
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -795,9 +1413,6 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 
 				goto on_error;
 			}
-			/* Make sure the truncate flag is removed from the handle
-			 */
-			internal_handle->access_flags &= ~( LIBBFIO_ACCESS_FLAG_TRUNCATE );
 		}
 	}
 	internal_handle = (libbfio_internal_handle_t *) handle;
@@ -831,7 +1446,28 @@ int libbfio_internal_pool_append_handle_to_last_used_list(
 		goto on_error;
 	}
 	internal_handle->pool_last_used_list_element = last_used_list_element;
+	internal_handle->pool_is_referenced          = 0;
+
+	if( internal_pool->eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_2Q )
+	{
+		/* A handle that is reopened shortly after it was closed while in the recently
+		 * used queue is added to the frequently used queue
+		 */
+		maximum_number_of_evictions = internal_pool->maximum_number_of_open_handles / 2;
+
+		if( maximum_number_of_evictions < 1 )
+		{
+			maximum_number_of_evictions = 1;
+		}
+		internal_handle->pool_is_frequently_used = 0;
 
+		if( ( internal_handle->pool_eviction_number != 0 )
+		 && ( ( internal_pool->number_of_evictions - internal_handle->pool_eviction_number ) < (uint64_t) maximum_number_of_evictions ) )
+		{
+			internal_handle->pool_is_frequently_used = 1;
+		}
+		internal_handle->pool_eviction_number = 0;
+	}
 	return( 1 );
 
 on_error:
@@ -845,18 +1481,29 @@ on_error:
 	return( -1 );
 }
 
-/* Moves the handle to the front of the last used list
- * Returns 1 if successful or -1 on error
+/* Retrieves the last used list element of the handle to close
+ * to limit the number of open handles
+ * The handle is determined by the eviction policy of the pool, pinned handles are not closed
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if no such element or -1 on error
  */
-int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
+int libbfio_internal_pool_get_eviction_list_element(
      libbfio_internal_pool_t *internal_pool,
-     libbfio_handle_t *handle,
+     libcdata_list_element_t **list_element,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle      = NULL;
-	libcdata_list_element_t *first_list_element     = NULL;
-	libcdata_list_element_t *last_used_list_element = NULL;
-	static char *function                           = "libbfio_internal_pool_move_handle_to_front_of_last_used_list";
+	libbfio_internal_handle_t *internal_handle            = NULL;
+	libcdata_list_element_t *eviction_list_element        = NULL;
+	libcdata_list_element_t *frequently_used_list_element = NULL;
+	libcdata_list_element_t *last_used_list_element       = NULL;
+	libcdata_list_element_t *previous_list_element        = NULL;
+	libcdata_list_element_t *recently_used_list_element   = NULL;
+	static char *function                                 = "libbfio_internal_pool_get_eviction_list_element";
+	uint32_t number_of_uses                               = 0;
+	int iterator                                          = 0;
+	int maximum_number_of_recently_used_handles           = 0;
+	int number_of_elements                                = 0;
+	int number_of_recently_used_handles                   = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -869,115 +1516,273 @@ int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
 
 		return( -1 );
 	}
-	if( internal_pool->last_used_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing last used list.",
-		 function );
-
-		return( -1 );
-	}
-	if( handle == NULL )
+	if( list_element == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid list element.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libbfio_internal_handle_t *) handle;
-
-	if( libcdata_list_get_first_element(
+	if( libcdata_list_get_number_of_elements(
 	     internal_pool->last_used_list,
-	     &first_list_element,
+	     &number_of_elements,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element from last used list.",
+		 "%s: unable to retrieve number of elements in last used list.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_handle->pool_last_used_list_element == NULL )
+	if( internal_pool->eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_CLOCK )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing last used list element.",
-		 function );
+		/* The end of the last used list acts as the clock hand, a handle that was used
+		 * is given a second chance by moving it to the front of the list, hence after
+		 * two rounds either an unused handle was found or all the handles are pinned
+		 */
+		for( iterator = 0;
+		     iterator < ( 2 * number_of_elements );
+		     iterator++ )
+		{
+			if( libcdata_list_get_last_element(
+			     internal_pool->last_used_list,
+			     &last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last list element from last used list.",
+				 function );
 
-		goto on_error;
+				return( -1 );
+			}
+			if( libcdata_list_element_get_value(
+			     last_used_list_element,
+			     (intptr_t **) &internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from last used list element.",
+				 function );
+
+				return( -1 );
+			}
+			if( internal_handle == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing last used list element value.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( internal_handle->pool_is_pinned == 0 )
+			 && ( internal_handle->pool_is_referenced == 0 ) )
+			{
+				eviction_list_element = last_used_list_element;
+
+				break;
+			}
+			internal_handle->pool_is_referenced = 0;
+
+			if( number_of_elements > 1 )
+			{
+				if( libcdata_list_remove_element(
+				     internal_pool->last_used_list,
+				     last_used_list_element,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove last used list element from list.",
+					 function );
+
+					return( -1 );
+				}
+				if( libcdata_list_prepend_element(
+				     internal_pool->last_used_list,
+				     last_used_list_element,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to prepend last used list element to list.",
+					 function );
+
+					internal_handle->pool_last_used_list_element = NULL;
+
+					libcdata_list_element_free(
+					 &last_used_list_element,
+					 NULL,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+		}
 	}
-	if( internal_handle->pool_last_used_list_element != first_list_element )
+	else
 	{
-		last_used_list_element = internal_handle->pool_last_used_list_element;
-
-		if( libcdata_list_remove_element(
+		if( libcdata_list_get_last_element(
 		     internal_pool->last_used_list,
-		     last_used_list_element,
+		     &last_used_list_element,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last used list element from list.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last list element from last used list.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_handle->pool_last_used_list_element = NULL;
+		while( last_used_list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     last_used_list_element,
+			     (intptr_t **) &internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from last used list element.",
+				 function );
 
-		if( libcdata_list_prepend_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
+				return( -1 );
+			}
+			if( internal_handle == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing last used list element value.",
+				 function );
+
+				return( -1 );
+			}
+			if( internal_handle->pool_is_pinned == 0 )
+			{
+				/* The last used list is walked from the least recently used handle
+				 * so that ties are resolved in favor of the least recently used handle
+				 */
+				if( internal_pool->eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_2Q )
+				{
+					if( internal_handle->pool_is_frequently_used != 0 )
+					{
+						if( frequently_used_list_element == NULL )
+						{
+							frequently_used_list_element = last_used_list_element;
+						}
+					}
+					else
+					{
+						if( recently_used_list_element == NULL )
+						{
+							recently_used_list_element = last_used_list_element;
+						}
+						number_of_recently_used_handles++;
+					}
+				}
+				else if( internal_pool->eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_LFU )
+				{
+					if( ( eviction_list_element == NULL )
+					 || ( internal_handle->pool_number_of_uses < number_of_uses ) )
+					{
+						eviction_list_element = last_used_list_element;
+						number_of_uses        = internal_handle->pool_number_of_uses;
+					}
+				}
+				else
+				{
+					eviction_list_element = last_used_list_element;
+
+					break;
+				}
+			}
+			if( libcdata_list_element_get_previous_element(
+			     last_used_list_element,
+			     &previous_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve previous last used list element.",
+				 function );
+
+				return( -1 );
+			}
+			last_used_list_element = previous_list_element;
+		}
+		if( internal_pool->eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_2Q )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to prepend last used list element to list.",
-			 function );
+			/* The recently used queue is limited to a quarter of the maximum number
+			 * of open handles, so that a scan cannot close the frequently used handles
+			 */
+			maximum_number_of_recently_used_handles = internal_pool->maximum_number_of_open_handles / 4;
 
-			goto on_error;
+			if( maximum_number_of_recently_used_handles < 1 )
+			{
+				maximum_number_of_recently_used_handles = 1;
+			}
+			if( ( recently_used_list_element != NULL )
+			 && ( ( number_of_recently_used_handles > maximum_number_of_recently_used_handles )
+			  ||  ( frequently_used_list_element == NULL ) ) )
+			{
+				eviction_list_element = recently_used_list_element;
+			}
+			else
+			{
+				eviction_list_element = frequently_used_list_element;
+			}
 		}
-		internal_handle->pool_last_used_list_element = last_used_list_element;
 	}
-	return( 1 );
+	*list_element = eviction_list_element;
 
-on_error:
-	if( last_used_list_element != NULL )
+	if( eviction_list_element == NULL )
 	{
-		libcdata_list_element_free(
-		 &last_used_list_element,
-		 NULL,
-		 NULL );
+		return( 0 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Removes a handle from the last used list
+/* Closes a handle that was removed from the last used list by the eviction policy
+ * This function is not multi-thread safe acquire write lock before call
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_remove_handle_from_last_used_list(
+int libbfio_internal_pool_close_evicted_handle(
      libbfio_internal_pool_t *internal_pool,
-     const libbfio_handle_t *handle,
+     libbfio_handle_t *handle,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *last_used_handle              = NULL;
-	libcdata_list_element_t *last_used_list_element = NULL;
-	static char *function                           = "libbfio_internal_pool_remove_handle_from_last_used_list";
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_close_evicted_handle";
+	uint64_t start_timestamp                   = 0;
+	int access_flags                           = 0;
+	int result                                 = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -1001,102 +1806,86 @@ int libbfio_internal_pool_remove_handle_from_last_used_list(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     internal_pool->last_used_list,
-	     &last_used_list_element,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element from last used list.",
-		 function );
+	internal_handle = (libbfio_internal_handle_t *) handle;
 
-		return( -1 );
+	/* The eviction policies, other than LRU, can close the current handle
+	 */
+	if( handle == internal_pool->current_handle )
+	{
+		internal_pool->current_entry  = -1;
+		internal_pool->current_handle = NULL;
 	}
-	while( last_used_list_element != NULL )
+	internal_pool->number_of_evictions += 1;
+
+	if( ( internal_pool->eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_2Q )
+	 && ( internal_handle->pool_is_frequently_used == 0 ) )
 	{
-		if( libcdata_list_element_get_value(
-		     last_used_list_element,
-		     (intptr_t **) &last_used_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last used handle.",
-			 function );
+		internal_handle->pool_eviction_number = internal_pool->number_of_evictions;
+	}
+	internal_handle->pool_is_frequently_used = 0;
+	internal_handle->pool_is_referenced      = 0;
 
-			return( -1 );
-		}
-		if( last_used_handle == handle )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     last_used_list_element,
-		     &last_used_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next last used list element.",
-			 function );
+	if( internal_pool->trace.is_enabled != 0 )
+	{
+		start_timestamp = libbfio_trace_begin(
+		                   &( internal_pool->trace ),
+		                   LIBBFIO_TRACE_OPERATION_CLOSE,
+		                   -1,
+		                   0,
+		                   0 );
+	}
+	result = libbfio_handle_close(
+	          handle,
+	          error );
 
-			return( -1 );
-		}
+	if( internal_pool->trace.is_enabled != 0 )
+	{
+		libbfio_trace_end(
+		 &( internal_pool->trace ),
+		 LIBBFIO_TRACE_OPERATION_CLOSE,
+		 -1,
+		 0,
+		 0,
+		 (int64_t) result,
+		 start_timestamp );
 	}
-	if( last_used_list_element != NULL )
+	if( result != 0 )
 	{
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last list element from last used list.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_element_free(
-		     &last_used_list_element,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free last used list element.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
+	/* Make sure the truncate flag is removed from the handle
+	 */
+	access_flags = (int) libbfio_atomic_load_int32(
+	                      &( internal_handle->access_flags ) );
+
+	libbfio_atomic_store_int32(
+	 &( internal_handle->access_flags ),
+	 access_flags & ~( LIBBFIO_ACCESS_FLAG_TRUNCATE ) );
+
 	return( 1 );
 }
 
-/* Retrieves the number of handles in the pool
+/* Moves the handle to the front of the last used list
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_get_number_of_handles(
-     libbfio_pool_t *pool,
-     int *number_of_handles,
+int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
      libcerror_error_t **error )
 {
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_number_of_handles";
-	int result                             = 1;
+	libbfio_internal_handle_t *internal_handle      = NULL;
+	libcdata_list_element_t *first_list_element     = NULL;
+	libcdata_list_element_t *last_used_list_element = NULL;
+	static char *function                           = "libbfio_internal_pool_move_handle_to_front_of_last_used_list";
 
-	if( pool == NULL )
+	if( internal_pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1107,66 +1896,259 @@ int libbfio_pool_get_number_of_handles(
 
 		return( -1 );
 	}
-	internal_pool = (libbfio_internal_pool_t *) pool;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_pool->read_write_lock,
-	     error ) != 1 )
+	if( internal_pool->last_used_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing last used list.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libcdata_array_get_number_of_entries(
-	     internal_pool->handles_array,
-	     number_of_handles,
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	if( libcdata_list_get_first_element(
+	     internal_pool->last_used_list,
+	     &first_list_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of handles.",
+		 "%s: unable to retrieve first list element from last used list.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_pool->read_write_lock,
+	if( internal_handle->pool_last_used_list_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing last used list element.",
+		 function );
+
+		goto on_error;
+	}
+	switch( internal_pool->eviction_policy )
+	{
+		case LIBBFIO_POOL_EVICTION_POLICY_CLOCK:
+			/* The order of the last used list is only changed on eviction
+			 */
+			internal_handle->pool_is_referenced = 1;
+
+			return( 1 );
+
+		case LIBBFIO_POOL_EVICTION_POLICY_2Q:
+			/* The recently used queue is first-in first-out
+			 */
+			if( internal_handle->pool_is_frequently_used == 0 )
+			{
+				return( 1 );
+			}
+			break;
+
+		case LIBBFIO_POOL_EVICTION_POLICY_LFU:
+			if( internal_handle->pool_number_of_uses < (uint32_t) UINT32_MAX )
+			{
+				internal_handle->pool_number_of_uses += 1;
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( internal_handle->pool_last_used_list_element != first_list_element )
+	{
+		last_used_list_element = internal_handle->pool_last_used_list_element;
+
+		if( libcdata_list_remove_element(
+		     internal_pool->last_used_list,
+		     last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last used list element from list.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->pool_last_used_list_element = NULL;
+
+		if( libcdata_list_prepend_element(
+		     internal_pool->last_used_list,
+		     last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend last used list element to list.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->pool_last_used_list_element = last_used_list_element;
+	}
+	return( 1 );
+
+on_error:
+	if( last_used_list_element != NULL )
+	{
+		libcdata_list_element_free(
+		 &last_used_list_element,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes a handle from the last used list
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_remove_handle_from_last_used_list(
+     libbfio_internal_pool_t *internal_pool,
+     const libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *last_used_handle              = NULL;
+	libcdata_list_element_t *last_used_list_element = NULL;
+	static char *function                           = "libbfio_internal_pool_remove_handle_from_last_used_list";
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     internal_pool->last_used_list,
+	     &last_used_list_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element from last used list.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	while( last_used_list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     last_used_list_element,
+		     (intptr_t **) &last_used_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last used handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( last_used_handle == handle )
+		{
+			break;
+		}
+		if( libcdata_list_element_get_next_element(
+		     last_used_list_element,
+		     &last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next last used list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( last_used_list_element != NULL )
+	{
+		if( libcdata_list_remove_element(
+		     internal_pool->last_used_list,
+		     last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last list element from last used list.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_free(
+		     &last_used_list_element,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free last used list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
-/* Retrieves a specific handle from the pool
+/* Retrieves the number of handles in the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_get_handle(
+int libbfio_pool_get_number_of_handles(
      libbfio_pool_t *pool,
-     int entry,
-     libbfio_handle_t **handle,
+     int *number_of_handles,
      libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_handle";
+	static char *function                  = "libbfio_pool_get_number_of_handles";
 	int result                             = 1;
 
 	if( pool == NULL )
@@ -1183,7 +2165,7 @@ int libbfio_pool_get_handle(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libbfio_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1197,24 +2179,22 @@ int libbfio_pool_get_handle(
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_entry_by_index(
+	if( libcdata_array_get_number_of_entries(
 	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) handle,
+	     number_of_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 "%s: unable to retrieve number of handles.",
+		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libbfio_lock_release_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1231,23 +2211,18 @@ int libbfio_pool_get_handle(
 	return( result );
 }
 
-/* Appends a handle to the pool
- * Sets the entry
+/* Retrieves a specific handle from the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_append_handle(
+int libbfio_pool_get_handle(
      libbfio_pool_t *pool,
-     int *entry,
-     libbfio_handle_t *handle,
-     int access_flags,
+     int entry,
+     libbfio_handle_t **handle,
      libcerror_error_t **error )
 {
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_append_handle";
-	int is_open                            = 0;
-	int number_of_handles                  = 0;
+	static char *function                  = "libbfio_pool_get_handle";
 	int result                             = 1;
-	int safe_entry                         = -1;
 
 	if( pool == NULL )
 	{
@@ -1262,12 +2237,92 @@ int libbfio_pool_append_handle(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( internal_pool->last_used_list == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Appends a handle to the pool
+ * Sets the entry
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_append_handle(
+     libbfio_pool_t *pool,
+     int *entry,
+     libbfio_handle_t *handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_append_handle";
+	int is_open                            = 0;
+	int number_of_handles                  = 0;
+	int result                             = 1;
+	int safe_entry                         = -1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( internal_pool->last_used_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: invalid pool - missing last used list.",
 		 function );
 
@@ -1321,7 +2376,7 @@ int libbfio_pool_append_handle(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1334,6 +2389,23 @@ int libbfio_pool_append_handle(
 
 		return( -1 );
 	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
 #endif
 	if( libcdata_array_get_number_of_entries(
 	     internal_pool->handles_array,
@@ -1392,7 +2464,24 @@ int libbfio_pool_append_handle(
 	{
 		internal_pool->number_of_used_handles += 1;
 
-		if( is_open != 0 )
+		if( internal_pool->descriptor_manager != NULL )
+		{
+			if( libbfio_internal_pool_set_handle_descriptor_manager(
+			     internal_pool,
+			     handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set descriptor manager of handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( is_open != 0 )
 		{
 			if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
 			{
@@ -1414,7 +2503,7 @@ int libbfio_pool_append_handle(
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1450,21 +2539,28 @@ on_error:
 	return( -1 );
 }
 
-/* Sets a specific handle in the pool
+/* Appends handles to the pool
+ * The handles array is resized once to fit all the handles
+ * Sets the entry of the first appended handle
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_set_handle(
+int libbfio_pool_append_handles(
      libbfio_pool_t *pool,
-     int entry,
-     libbfio_handle_t *handle,
+     int *first_entry,
+     libbfio_handle_t * const handles[],
+     int number_of_handles,
      int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *backup_handle = NULL;
-	libbfio_internal_pool_t *internal_pool   = NULL;
-	static char *function                    = "libbfio_pool_set_handle";
-	int is_open                              = 0;
-	int result                               = 1;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_internal_pool_t *internal_pool     = NULL;
+	static char *function                      = "libbfio_pool_append_handles";
+	int handle_index                           = 0;
+	int is_open                                = 0;
+	int number_of_entries                      = 0;
+	int number_of_set_handles                  = 0;
+	int result                                 = 1;
+	int safe_first_entry                       = -1;
 
 	if( pool == NULL )
 	{
@@ -1490,44 +2586,84 @@ int libbfio_pool_set_handle(
 
 		return( -1 );
 	}
-	/* Check if the handle is open
-	 */
-	is_open = libbfio_handle_is_open(
-	           handle,
-	           error );
+	if( first_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first entry.",
+		 function );
 
-	if( is_open == -1 )
+		return( -1 );
+	}
+	if( handles == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handles.",
 		 function );
 
 		return( -1 );
 	}
-	else if( is_open == 0 )
+	if( number_of_handles <= 0 )
 	{
-		/* Set the access flags is the handle is not open
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of handles zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		/* Check if the handle is open
 		 */
-		if( libbfio_handle_set_access_flags(
-		     handle,
-		     access_flags,
-		     error ) != 1 )
+		is_open = libbfio_handle_is_open(
+		           handles[ handle_index ],
+		           error );
+
+		if( is_open == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to set access flags.",
-			 function );
+			 "%s: unable to determine if handle: %d is open.",
+			 function,
+			 handle_index );
 
 			return( -1 );
 		}
+		else if( is_open == 0 )
+		{
+			/* Set the access flags is the handle is not open
+			 */
+			if( libbfio_handle_set_access_flags(
+			     handles[ handle_index ],
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to set access flags of handle: %d.",
+				 function,
+				 handle_index );
+
+				return( -1 );
+			}
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1540,124 +2676,236 @@ int libbfio_pool_set_handle(
 
 		return( -1 );
 	}
-#endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &backup_handle,
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
 
-		result = -1;
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
 	}
-/* TODO allow to re set handles, make sure all pool references are removed */
-	else if( backup_handle != NULL )
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_pool->handles_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle entry: %d value already set.",
-		 function,
-		 entry );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
 
 		result = -1;
 	}
-	else if( libcdata_array_set_entry_by_index(
-	          internal_pool->handles_array,
-	          entry,
-	          (intptr_t *) handle,
-	          error ) != 1 )
+	else if( number_of_handles > ( INT_MAX - internal_pool->number_of_used_handles ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set handle: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of handles value exceeds maximum.",
+		 function );
 
 		result = -1;
 	}
+	else if( ( internal_pool->number_of_used_handles + number_of_handles ) > number_of_entries )
+	{
+		if( libcdata_array_resize(
+		     internal_pool->handles_array,
+		     internal_pool->number_of_used_handles + number_of_handles,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_handle_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize handles array.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( result == 1 )
 	{
-		if( is_open != 0 )
+		safe_first_entry = internal_pool->number_of_used_handles;
+
+		for( handle_index = 0;
+		     handle_index < number_of_handles;
+		     handle_index++ )
 		{
-			if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+			if( libcdata_array_set_entry_by_index(
+			     internal_pool->handles_array,
+			     safe_first_entry + handle_index,
+			     (intptr_t *) handles[ handle_index ],
+			     error ) != 1 )
 			{
-				if( libbfio_internal_pool_append_handle_to_last_used_list(
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set handle: %d.",
+				 function,
+				 safe_first_entry + handle_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_set_handles++;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_pool->number_of_used_handles += number_of_handles;
+
+		if( internal_pool->descriptor_manager != NULL )
+		{
+			for( handle_index = 0;
+			     handle_index < number_of_handles;
+			     handle_index++ )
+			{
+				if( libbfio_internal_pool_set_handle_descriptor_manager(
 				     internal_pool,
-				     handle,
+				     handles[ handle_index ],
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append handle to last used list.",
-					 function );
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set descriptor manager of handle: %d.",
+					 function,
+					 handle_index );
 
 					result = -1;
+
+					break;
 				}
 			}
 		}
-		if( entry == internal_pool->current_entry )
+		else if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
 		{
-			internal_pool->current_entry  = -1;
-			internal_pool->current_handle = NULL;
-		}
-	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_pool->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
+			for( handle_index = 0;
+			     handle_index < number_of_handles;
+			     handle_index++ )
+			{
+				is_open = libbfio_handle_is_open(
+				           handles[ handle_index ],
+				           error );
+
+				if( is_open == 0 )
+				{
+					continue;
+				}
+				else if( ( is_open == -1 )
+				      || ( libbfio_internal_pool_append_handle_to_last_used_list(
+				            internal_pool,
+				            handles[ handle_index ],
+				            error ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append handle: %d to last used list.",
+					 function,
+					 handle_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		/* Revert the appended handles so that they remain owned by the caller
+		 */
+		for( handle_index = 0;
+		     handle_index < number_of_set_handles;
+		     handle_index++ )
+		{
+			internal_handle = (libbfio_internal_handle_t *) handles[ handle_index ];
+
+			if( internal_handle->pool_last_used_list_element != NULL )
+			{
+				libbfio_internal_pool_remove_handle_from_last_used_list(
+				 internal_pool,
+				 handles[ handle_index ],
+				 NULL );
+
+				internal_handle->pool_last_used_list_element = NULL;
+			}
+			if( internal_pool->descriptor_manager != NULL )
+			{
+				libbfio_handle_set_descriptor_manager(
+				 handles[ handle_index ],
+				 NULL,
+				 NULL );
+			}
+			libcdata_array_set_entry_by_index(
+			 internal_pool->handles_array,
+			 safe_first_entry + handle_index,
+			 NULL,
+			 NULL );
+		}
+		if( number_of_set_handles == number_of_handles )
+		{
+			internal_pool->number_of_used_handles -= number_of_handles;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
 	if( result != 1 )
 	{
-		goto on_error;
+		return( -1 );
 	}
-	return( result );
-
-on_error:
-	libcdata_array_set_entry_by_index(
-	 internal_pool->handles_array,
-	 entry,
-	 (intptr_t *) backup_handle,
-	 NULL );
+	*first_entry = safe_first_entry;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Removes a specific handle from the pool
+/* Sets a specific handle in the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_remove_handle(
+int libbfio_pool_set_handle(
      libbfio_pool_t *pool,
      int entry,
-     libbfio_handle_t **handle,
+     libbfio_handle_t *handle,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *backup_handle        = NULL;
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_remove_handle";
-	int result                             = 1;
+	libbfio_internal_handle_t *backup_handle = NULL;
+	libbfio_internal_pool_t *internal_pool   = NULL;
+	static char *function                    = "libbfio_pool_set_handle";
+	int is_open                              = 0;
+	int result                               = 1;
 
 	if( pool == NULL )
 	{
@@ -1683,21 +2931,44 @@ int libbfio_pool_remove_handle(
 
 		return( -1 );
 	}
-	if( handle == NULL )
+	/* Check if the handle is open
+	 */
+	is_open = libbfio_handle_is_open(
+	           handle,
+	           error );
+
+	if( is_open == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if handle is open.",
 		 function );
 
 		return( -1 );
 	}
-	*handle = NULL;
+	else if( is_open == 0 )
+	{
+		/* Set the access flags is the handle is not open
+		 */
+		if( libbfio_handle_set_access_flags(
+		     handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to set access flags.",
+			 function );
 
+			return( -1 );
+		}
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1710,6 +2981,23 @@ int libbfio_pool_remove_handle(
 
 		return( -1 );
 	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
 #endif
 	if( libcdata_array_get_entry_by_index(
 	     internal_pool->handles_array,
@@ -1727,59 +3015,82 @@ int libbfio_pool_remove_handle(
 
 		result = -1;
 	}
-	if( result == 1 )
+/* TODO allow to re set handles, make sure all pool references are removed */
+	else if( backup_handle != NULL )
 	{
-		if( libbfio_internal_pool_remove_handle_from_last_used_list(
-		     internal_pool,
-		     backup_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove handle: %d from last used list.",
-			 function,
-			 entry );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle entry: %d value already set.",
+		 function,
+		 entry );
 
-			result = -1;
-		}
+		result = -1;
+	}
+	else if( libcdata_array_set_entry_by_index(
+	          internal_pool->handles_array,
+	          entry,
+	          (intptr_t *) handle,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
 	}
 	if( result == 1 )
 	{
-		if( entry == internal_pool->current_entry )
+		if( internal_pool->descriptor_manager != NULL )
 		{
-			internal_pool->current_entry  = -1;
-			internal_pool->current_handle = NULL;
+			if( libbfio_internal_pool_set_handle_descriptor_manager(
+			     internal_pool,
+			     handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set descriptor manager of handle.",
+				 function );
+
+				result = -1;
+			}
 		}
-		if( libcdata_array_set_entry_by_index(
-		     internal_pool->handles_array,
-		     entry,
-		     NULL,
-		     error ) != 1 )
+		else if( is_open != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set handle: %d.",
-			 function,
-			 entry );
-
-			libbfio_internal_pool_append_handle_to_last_used_list(
-			 internal_pool,
-			 backup_handle,
-			 NULL );
+			if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+			{
+				if( libbfio_internal_pool_append_handle_to_last_used_list(
+				     internal_pool,
+				     handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append handle to last used list.",
+					 function );
 
-			result = -1;
+					result = -1;
+				}
+			}
+		}
+		if( entry == internal_pool->current_entry )
+		{
+			internal_pool->current_entry  = -1;
+			internal_pool->current_handle = NULL;
 		}
-	}
-	if( result == 1 )
-	{
-		internal_pool->number_of_used_handles -= 1;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1793,43 +3104,37 @@ int libbfio_pool_remove_handle(
 		goto on_error;
 	}
 #endif
-	if( result == 1 )
+	if( result != 1 )
 	{
-		*handle = backup_handle;
+		goto on_error;
 	}
 	return( result );
 
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
 on_error:
-	if( result == 1 )
-	{
-		libcdata_array_set_entry_by_index(
-		 internal_pool->handles_array,
-		  entry,
-		  (intptr_t *) backup_handle,
-		  NULL );
-
-		libbfio_internal_pool_append_handle_to_last_used_list(
-		 internal_pool,
-		 backup_handle,
-		 NULL );
+	libcdata_array_set_entry_by_index(
+	 internal_pool->handles_array,
+	 entry,
+	 (intptr_t *) backup_handle,
+	 NULL );
 
-		internal_pool->number_of_used_handles += 1;
-	}
 	return( -1 );
-#endif
 }
 
-/* Retrieves the maximum number of open handles in the pool
+/* Removes a specific handle from the pool
+ * A handle that was created by the pool from its arena cannot be removed
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_get_maximum_number_of_open_handles(
+int libbfio_pool_remove_handle(
      libbfio_pool_t *pool,
-     int *maximum_number_of_open_handles,
+     int entry,
+     libbfio_handle_t **handle,
      libcerror_error_t **error )
 {
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_maximum_number_of_open_handles";
+	libbfio_handle_t *backup_handle            = NULL;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_internal_pool_t *internal_pool     = NULL;
+	static char *function                      = "libbfio_pool_remove_handle";
+	int result                                 = 1;
 
 	if( pool == NULL )
 	{
@@ -1844,36 +3149,32 @@ int libbfio_pool_get_maximum_number_of_open_handles(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( maximum_number_of_open_handles == NULL )
+	if( internal_pool->last_used_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid maximum number of open handles.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing last used list.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_pool->read_write_lock,
-	     error ) != 1 )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*maximum_number_of_open_handles = internal_pool->maximum_number_of_open_handles;
+	*handle = NULL;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1881,28 +3182,195 @@ int libbfio_pool_get_maximum_number_of_open_handles(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
 		 function );
 
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &backup_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	if( ( result == 1 )
+	 && ( backup_handle != NULL ) )
+	{
+		internal_handle = (libbfio_internal_handle_t *) backup_handle;
+
+		/* A handle allocated from the arena of the pool is freed together with the pool
+		 */
+		if( internal_handle->is_arena_allocated != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported handle: %d - handle is allocated from the arena of the pool.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libbfio_internal_pool_remove_handle_from_last_used_list(
+		     internal_pool,
+		     backup_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove handle: %d from last used list.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_handle_set_descriptor_manager(
+		     backup_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to remove handle: %d from descriptor manager.",
+			 function,
+			 entry );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( entry == internal_pool->current_entry )
+		{
+			internal_pool->current_entry  = -1;
+			internal_pool->current_handle = NULL;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_pool->handles_array,
+		     entry,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set handle: %d.",
+			 function,
+			 entry );
+
+			libbfio_internal_pool_append_handle_to_last_used_list(
+			 internal_pool,
+			 backup_handle,
+			 NULL );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_pool->number_of_used_handles -= 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == 1 )
+	{
+		internal_handle = (libbfio_internal_handle_t *) backup_handle;
+
+		internal_handle->pool_is_pinned          = 0;
+		internal_handle->pool_is_referenced      = 0;
+		internal_handle->pool_is_frequently_used = 0;
+		internal_handle->pool_number_of_uses     = 0;
+		internal_handle->pool_eviction_number    = 0;
+
+		*handle = backup_handle;
+	}
+	return( result );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+on_error:
+	if( result == 1 )
+	{
+		libcdata_array_set_entry_by_index(
+		 internal_pool->handles_array,
+		  entry,
+		  (intptr_t *) backup_handle,
+		  NULL );
+
+		libbfio_internal_pool_append_handle_to_last_used_list(
+		 internal_pool,
+		 backup_handle,
+		 NULL );
+
+		internal_pool->number_of_used_handles += 1;
+	}
+	return( -1 );
+#endif
 }
 
-/* Sets the maximum number of open handles in the pool
+/* Retrieves the maximum number of open handles in the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_set_maximum_number_of_open_handles(
+int libbfio_pool_get_maximum_number_of_open_handles(
      libbfio_pool_t *pool,
-     int maximum_number_of_open_handles,
+     int *maximum_number_of_open_handles,
      libcerror_error_t **error )
 {
-	libbfio_internal_handle_t *internal_handle           = NULL;
-	libbfio_internal_pool_t *internal_pool               = NULL;
-	libcdata_list_element_t *last_used_list_element      = NULL;
-	libcdata_list_element_t *safe_last_used_list_element = NULL;
-	static char *function                                = "libbfio_pool_set_maximum_number_of_open_handles";
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_maximum_number_of_open_handles";
 
 	if( pool == NULL )
 	{
@@ -1917,19 +3385,19 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( maximum_number_of_open_handles < 0 )
+	if( maximum_number_of_open_handles == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
-		 "%s: invalid maximum number of open handles value less than zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of open handles.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_read(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1937,31 +3405,86 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_open_handles = internal_pool->maximum_number_of_open_handles;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
+	return( 1 );
+}
+
+/* Sets the maximum number of open handles in the pool
+ * Closes the handles determined by the eviction policy if necessary
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_set_maximum_number_of_open_handles(
+     libbfio_internal_pool_t *internal_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle           = NULL;
+	libcdata_list_element_t *last_used_list_element      = NULL;
+	libcdata_list_element_t *safe_last_used_list_element = NULL;
+	static char *function                                = "libbfio_internal_pool_set_maximum_number_of_open_handles";
+	int result                                           = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
 	internal_pool->maximum_number_of_open_handles = maximum_number_of_open_handles;
 
 	while( ( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
 	    && ( internal_pool->number_of_open_handles > internal_pool->maximum_number_of_open_handles ) )
 	{
-		if( libcdata_list_get_last_element(
-		     internal_pool->last_used_list,
-		     &last_used_list_element,
-		     error ) != 1 )
+		result = libbfio_internal_pool_get_eviction_list_element(
+		          internal_pool,
+		          &last_used_list_element,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last list element from last used list.",
+			 "%s: unable to retrieve eviction list element from last used list.",
 			 function );
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			/* The remaining open handles are pinned
+			 */
+			break;
+		}
 		if( libcdata_list_element_get_value(
 		     last_used_list_element,
 		     (intptr_t **) &internal_handle,
@@ -2005,9 +3528,10 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 
 		internal_handle->pool_last_used_list_element = NULL;
 
-		if( libbfio_handle_close(
+		if( libbfio_internal_pool_close_evicted_handle(
+		     internal_pool,
 		     (libbfio_handle_t *) internal_handle,
-		     error ) != 0 )
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2020,10 +3544,6 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 		}
 		internal_pool->number_of_open_handles--;
 
-		/* Make sure the truncate flag is removed from the handle
-		 */
-		internal_handle->access_flags &= ~( LIBBFIO_ACCESS_FLAG_TRUNCATE );
-
 		if( libcdata_list_element_free(
 		     &safe_last_used_list_element,
 		     NULL,
@@ -2039,21 +3559,6 @@ int libbfio_pool_set_maximum_number_of_open_handles(
 			goto on_error;
 		}
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_pool->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( 1 );
 
 on_error:
@@ -2064,28 +3569,21 @@ on_error:
 		 NULL,
 		 NULL );
 	}
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_pool->read_write_lock,
-	 NULL );
-#endif
 	return( -1 );
 }
 
-/* Opens a handle in the pool
+/* Sets the maximum number of open handles in the pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_open(
-     libbfio_internal_pool_t *internal_pool,
-     int entry,
-     int access_flags,
+int libbfio_pool_set_maximum_number_of_open_handles(
+     libbfio_pool_t *pool,
+     int maximum_number_of_open_handles,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle = NULL;
-	static char *function    = "libbfio_internal_pool_open";
-	int is_open              = 0;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_maximum_number_of_open_handles";
 
-	if( internal_pool == NULL )
+	if( pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2096,133 +3594,78 @@ int libbfio_internal_pool_open(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
-
-		return( -1 );
-	}
-	/* Make sure the handle is not already open
-	 */
-	is_open = libbfio_handle_is_open(
-	           handle,
-	           error );
+	internal_pool = (libbfio_internal_pool_t *) pool;
 
-	if( is_open == -1 )
+	if( maximum_number_of_open_handles < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if entry: %d is open.",
-		 function,
-	         entry );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
 
 		return( -1 );
 	}
-	else if( is_open == 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: entry: %d is already open.",
-		 function,
-	         entry );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	if( libbfio_internal_pool_open_handle(
+	if( libbfio_internal_pool_wait_for_pre_open(
 	     internal_pool,
-	     handle,
-	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open entry: %d.",
-		 function,
-		 entry );
-
-		return( -1 );
-	}
-	internal_pool->current_entry  = entry;
-	internal_pool->current_handle = handle;
-
-	return( 1 );
-}
-
-/* Opens a handle in the pool
- * Returns 1 if successful or -1 on error
- */
-int libbfio_pool_open(
-     libbfio_pool_t *pool,
-     int entry,
-     int access_flags,
-     libcerror_error_t **error )
-{
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_open";
-	int result                             = 1;
-
-	if( pool == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid pool.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
 		 function );
 
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
 		return( -1 );
 	}
-	internal_pool = (libbfio_internal_pool_t *) pool;
-
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_pool->read_write_lock,
-	     error ) != 1 )
+#endif
+	if( internal_pool->descriptor_manager != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool - descriptor manager already set.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libbfio_internal_pool_open(
+	if( libbfio_internal_pool_set_maximum_number_of_open_handles(
 	     internal_pool,
-	     entry,
-	     access_flags,
+	     maximum_number_of_open_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open entry: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of open handles.",
+		 function );
 
-		result = -1;
+		goto on_error;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2236,21 +3679,32 @@ int libbfio_pool_open(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libbfio_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Reopens a handle in the pool
+/* Sets the value to indicate the maximum number of open handles in the pool is adaptive
+ * The maximum number of open handles is then increased while handles are frequently reopened
+ * and descriptors are available, and decreased when the process runs out of descriptors
+ * The current maximum number of open handles is used as the initial value
+ * 0 disables the adaptive maximum any other value enables it
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_reopen(
+int libbfio_pool_set_adaptive_maximum_number_of_open_handles(
      libbfio_pool_t *pool,
-     int entry,
-     int access_flags,
+     uint8_t adaptive_maximum_number_of_open_handles,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_reopen";
+	static char *function                  = "libbfio_pool_set_adaptive_maximum_number_of_open_handles";
+	int maximum_number_of_open_handles     = 0;
 
 	if( pool == NULL )
 	{
@@ -2266,7 +3720,7 @@ int libbfio_pool_reopen(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2279,43 +3733,69 @@ int libbfio_pool_reopen(
 
 		return( -1 );
 	}
-#endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &handle,
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
 
-		goto on_error;
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
 	}
-	if( libbfio_handle_reopen(
-	     handle,
-	     access_flags,
-	     error ) != 1 )
+#endif
+	if( internal_pool->descriptor_manager != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to reopen handle for entry: %d.",
-		 function,
-		 entry );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool - descriptor manager already set.",
+		 function );
 
 		goto on_error;
 	}
-	internal_pool->current_entry  = entry;
-	internal_pool->current_handle = handle;
+	if( adaptive_maximum_number_of_open_handles != 0 )
+	{
+		maximum_number_of_open_handles = internal_pool->maximum_number_of_open_handles;
+
+		if( ( maximum_number_of_open_handles == LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+		 || ( maximum_number_of_open_handles < LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES ) )
+		{
+			maximum_number_of_open_handles = LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES;
+		}
+		if( libbfio_internal_pool_set_maximum_number_of_open_handles(
+		     internal_pool,
+		     maximum_number_of_open_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles.",
+			 function );
+
+			goto on_error;
+		}
+		internal_pool->adaptive_maximum_number_of_open_handles = 1;
+	}
+	else
+	{
+		internal_pool->adaptive_maximum_number_of_open_handles = 0;
+	}
+	internal_pool->adaptive_number_of_accesses = 0;
+	internal_pool->adaptive_number_of_reopens  = 0;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2333,26 +3813,25 @@ int libbfio_pool_reopen(
 
 on_error:
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
+	libbfio_lock_release_for_write(
 	 internal_pool->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Closes a handle in the pool
- * Returns 0 if successful or -1 on error
+/* Adapts the maximum number of open handles in the pool to the reopen rate
+ * and the number of descriptors available to the process
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
  */
-int libbfio_internal_pool_close(
+int libbfio_internal_pool_adapt_maximum_number_of_open_handles(
      libbfio_internal_pool_t *internal_pool,
-     int entry,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle                             = NULL;
-	libbfio_internal_handle_t *internal_handle           = NULL;
-	libcdata_list_element_t *last_used_list_element      = NULL;
-	libcdata_list_element_t *safe_last_used_list_element = NULL;
-	static char *function                                = "libbfio_internal_pool_close";
+	static char *function              = "libbfio_internal_pool_adapt_maximum_number_of_open_handles";
+	int maximum_number_of_descriptors  = 0;
+	int maximum_number_of_open_handles = 0;
 
 	if( internal_pool == NULL )
 	{
@@ -2365,142 +3844,3114 @@ int libbfio_internal_pool_close(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_pool->handles_array,
-	     entry,
-	     (intptr_t **) &handle,
+	if( internal_pool->maximum_number_of_open_handles == LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+		internal_pool->adaptive_number_of_accesses = 0;
+		internal_pool->adaptive_number_of_reopens  = 0;
+
+		return( 1 );
+	}
+	/* The resource limits are determined every time since they can be changed
+	 * while the process is running
+	 */
+	if( libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+	     &maximum_number_of_descriptors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 "%s: unable to retrieve maximum number of descriptors.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( handle == NULL )
+	if( maximum_number_of_descriptors < LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid pool - missing handle for entry: %d.",
-		 function,
-		 entry );
+		maximum_number_of_descriptors = LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES;
+	}
+	maximum_number_of_open_handles = internal_pool->maximum_number_of_open_handles;
 
-		goto on_error;
+	/* Only increase the maximum if the handles are reopened because the maximum was reached
+	 */
+	if( ( ( internal_pool->adaptive_number_of_reopens * LIBBFIO_POOL_ADAPTIVE_REOPEN_RATE_DIVISOR ) > internal_pool->adaptive_number_of_accesses )
+	 && ( ( internal_pool->number_of_open_handles + 1 ) >= maximum_number_of_open_handles ) )
+	{
+		if( maximum_number_of_open_handles > ( maximum_number_of_descriptors / 2 ) )
+		{
+			maximum_number_of_open_handles = maximum_number_of_descriptors;
+		}
+		else
+		{
+			maximum_number_of_open_handles *= 2;
+		}
 	}
-	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	if( maximum_number_of_open_handles > maximum_number_of_descriptors )
 	{
-/* TODO move into get function */
-		internal_handle = (libbfio_internal_handle_t *) handle;
-
-		last_used_list_element = internal_handle->pool_last_used_list_element;
-
-		if( libcdata_list_element_get_value(
-		     last_used_list_element,
-		     (intptr_t **) &internal_handle,
+		maximum_number_of_open_handles = maximum_number_of_descriptors;
+	}
+	if( maximum_number_of_open_handles != internal_pool->maximum_number_of_open_handles )
+	{
+		if( libbfio_internal_pool_set_maximum_number_of_open_handles(
+		     internal_pool,
+		     maximum_number_of_open_handles,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from last used list element.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of open handles.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( internal_handle == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing last used list element value.",
-			 function );
+	}
+	internal_pool->adaptive_number_of_accesses = 0;
+	internal_pool->adaptive_number_of_reopens  = 0;
+
+	return( 1 );
+}
+
+/* Decreases the maximum number of open handles in the pool after a handle failed to open
+ * The handle is the handle that failed to open, it is not closed
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if the maximum was decreased, 0 if not or -1 on error
+ */
+int libbfio_internal_pool_decrease_maximum_number_of_open_handles(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	static char *function                      = "libbfio_internal_pool_decrease_maximum_number_of_open_handles";
+	int maximum_number_of_open_handles         = 0;
+	int result                                 = 0;
+	uint8_t is_pinned                          = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	maximum_number_of_open_handles = internal_pool->number_of_open_handles / 2;
+
+	if( maximum_number_of_open_handles < LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES )
+	{
+		maximum_number_of_open_handles = LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES;
+	}
+	if( ( internal_pool->maximum_number_of_open_handles == LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	 || ( maximum_number_of_open_handles >= internal_pool->maximum_number_of_open_handles ) )
+	{
+		return( 0 );
+	}
+	/* The handle is pinned so that it is not closed by the eviction policy
+	 */
+	is_pinned = internal_handle->pool_is_pinned;
+
+	internal_handle->pool_is_pinned = 1;
+
+	result = libbfio_internal_pool_set_maximum_number_of_open_handles(
+	          internal_pool,
+	          maximum_number_of_open_handles,
+	          error );
+
+	internal_handle->pool_is_pinned = is_pinned;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool->adaptive_number_of_accesses = 0;
+	internal_pool->adaptive_number_of_reopens  = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the eviction policy
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_eviction_policy(
+     libbfio_pool_t *pool,
+     int *eviction_policy,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_eviction_policy";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( eviction_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid eviction policy.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*eviction_policy = internal_pool->eviction_policy;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the eviction policy
+ * The eviction policy determines which handle is closed when
+ * the maximum number of open handles is reached
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_eviction_policy(
+     libbfio_pool_t *pool,
+     int eviction_policy,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_eviction_policy";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( ( eviction_policy != LIBBFIO_POOL_EVICTION_POLICY_LRU )
+	 && ( eviction_policy != LIBBFIO_POOL_EVICTION_POLICY_CLOCK )
+	 && ( eviction_policy != LIBBFIO_POOL_EVICTION_POLICY_2Q )
+	 && ( eviction_policy != LIBBFIO_POOL_EVICTION_POLICY_LFU ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported eviction policy.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	internal_pool->eviction_policy = eviction_policy;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate a specific handle in the pool is pinned
+ * A pinned handle is not closed to limit the number of open handles,
+ * hence the maximum number of open handles is exceeded if all the open handles are pinned
+ * 0 unpins the handle any other value pins it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_handle_pinned(
+     libbfio_pool_t *pool,
+     int entry,
+     uint8_t pinned,
+     libcerror_error_t **error )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_internal_pool_t *internal_pool     = NULL;
+	static char *function                      = "libbfio_pool_set_handle_pinned";
+	int result                                 = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	else if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+	else if( pinned != 0 )
+	{
+		internal_handle->pool_is_pinned = 1;
+	}
+	else
+	{
+		internal_handle->pool_is_pinned = 0;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the descriptor manager
+ * The descriptor manager replaces the maximum number of open handles of the pool
+ * and limits the number of open handles of all the pools and handles that share it
+ * The descriptor manager is not managed by the pool and must outlive it
+ * The descriptor manager can only be set while the pool contains no handles
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_descriptor_manager(
+     libbfio_pool_t *pool,
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_descriptor_manager";
+	int result                             = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_pool->number_of_used_handles != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool - handles already set.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_pool->descriptor_manager = descriptor_manager;
+
+		/* The pool does not limit the number of open handles itself
+		 * if a descriptor manager is used
+		 */
+		if( descriptor_manager != NULL )
+		{
+			internal_pool->maximum_number_of_open_handles          = LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES;
+			internal_pool->adaptive_maximum_number_of_open_handles = 0;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the value to indicate the handles created by the pool are only used by a single thread
+ * The file pool functions then create handles without a read/write lock, this is only
+ * safe if the handles are exclusively accessed through the pool functions
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_single_threaded_handles(
+     libbfio_pool_t *pool,
+     uint8_t single_threaded_handles,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_single_threaded_handles";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( single_threaded_handles != 0 )
+	{
+		internal_pool->handle_flags |= LIBBFIO_FLAG_SINGLE_THREADED;
+	}
+	else
+	{
+		internal_pool->handle_flags &= ~( LIBBFIO_FLAG_SINGLE_THREADED );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate the next entry should be opened in advance
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_pre_open_next_entry(
+     libbfio_pool_t *pool,
+     uint8_t pre_open_next_entry,
+     size64_t prefetch_size,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_pre_open_next_entry";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( prefetch_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid prefetch size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_pool->pre_open_next_entry    = (uint8_t) ( pre_open_next_entry != 0 );
+	internal_pool->pre_open_prefetch_size = prefetch_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the error mode
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_get_error_mode(
+     libbfio_pool_t *pool,
+     int *error_mode,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_error_mode";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( error_mode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error mode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*error_mode = internal_pool->error_mode;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the error mode
+ * In lightweight error mode a failed read, including a failure to open the handle
+ * on demand, does not set the error but only records the error domain and code
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_error_mode(
+     libbfio_pool_t *pool,
+     int error_mode,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_error_mode";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( ( error_mode != LIBBFIO_ERROR_MODE_DEFAULT )
+	 && ( error_mode != LIBBFIO_ERROR_MODE_LIGHTWEIGHT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported error mode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_pool->error_mode = error_mode;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the error domain and code of the last failed read or open of a handle
+ * The error domain and code are recorded in both the default and lightweight error mode
+ * Returns 1 if successful, 0 if the last read did not fail or -1 on error
+ */
+int libbfio_pool_get_last_error(
+     libbfio_pool_t *pool,
+     int *error_domain,
+     int *error_code,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_last_error";
+	int result                             = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( error_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error domain.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_pool->last_error_domain != 0 )
+	{
+		*error_domain = internal_pool->last_error_domain;
+		*error_code   = internal_pool->last_error_code;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_read(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets if the lock statistics should be tracked
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_track_lock_statistics(
+     libbfio_pool_t *pool,
+     uint8_t track_lock_statistics,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_track_lock_statistics";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_set_track_statistics(
+	     internal_pool->read_write_lock,
+	     track_lock_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track lock statistics.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBBFIO_UNREFERENCED_PARAMETER( internal_pool )
+	LIBBFIO_UNREFERENCED_PARAMETER( track_lock_statistics )
+#endif
+	return( 1 );
+}
+
+/* Retrieves the lock statistics
+ * The number of grabs, the number of grabs that had to wait for the lock
+ * and the total and maximum wait time in nano seconds
+ * Returns 1 if successful, 0 if the pool has no lock or -1 on error
+ */
+int libbfio_pool_get_lock_statistics(
+     libbfio_pool_t *pool,
+     uint64_t *number_of_grabs,
+     uint64_t *number_of_contended_grabs,
+     uint64_t *total_wait_time,
+     uint64_t *maximum_wait_time,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_get_lock_statistics";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The lock is not grabbed since that would affect the statistics
+	 */
+	if( libbfio_lock_get_statistics(
+	     internal_pool->read_write_lock,
+	     number_of_grabs,
+	     number_of_contended_grabs,
+	     total_wait_time,
+	     maximum_wait_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lock statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	LIBBFIO_UNREFERENCED_PARAMETER( internal_pool )
+	LIBBFIO_UNREFERENCED_PARAMETER( number_of_grabs )
+	LIBBFIO_UNREFERENCED_PARAMETER( number_of_contended_grabs )
+	LIBBFIO_UNREFERENCED_PARAMETER( total_wait_time )
+	LIBBFIO_UNREFERENCED_PARAMETER( maximum_wait_time )
+
+	return( 0 );
+#endif
+}
+
+/* Sets the trace callbacks
+ * The pre callback is called before and the post callback after every open,
+ * close, seek, read and write with the duration in nano seconds
+ * The entry of the pool the operation applies to is passed to the callbacks
+ * The callbacks are called while the lock is held and should not call back
+ * into the pool, tracing is disabled when both callbacks are NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_trace_callbacks(
+     libbfio_pool_t *pool,
+     void (*pre_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size ),
+     void (*post_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size,
+            int64_t result,
+            uint64_t duration ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_trace_callbacks";
+	int result                             = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_trace_set_callbacks(
+	     &( internal_pool->trace ),
+	     pre_callback,
+	     post_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callbacks.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the trace recorder
+ * The trace recorder is not managed by the pool, use NULL to remove it
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_set_trace_recorder(
+     libbfio_pool_t *pool,
+     libbfio_trace_recorder_t *trace_recorder,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_set_trace_recorder";
+	int result            = 0;
+
+	if( trace_recorder == NULL )
+	{
+		result = libbfio_pool_set_trace_callbacks(
+		          pool,
+		          NULL,
+		          NULL,
+		          NULL,
+		          error );
+	}
+	else
+	{
+		result = libbfio_pool_set_trace_callbacks(
+		          pool,
+		          NULL,
+		          &libbfio_trace_recorder_post_callback,
+		          (intptr_t *) trace_recorder,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_open(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle = NULL;
+	static char *function    = "libbfio_internal_pool_open";
+	int is_open              = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	/* Make sure the handle is not already open
+	 */
+	is_open = libbfio_handle_is_open(
+	           handle,
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if entry: %d is open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	else if( is_open == 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: entry: %d is already open.",
+		 function,
+	         entry );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_open_handle(
+	     internal_pool,
+	     entry,
+	     handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	internal_pool->current_entry  = entry;
+	internal_pool->current_handle = handle;
+
+	return( 1 );
+}
+
+/* Opens a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_open(
+     libbfio_pool_t *pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_open";
+	int result                             = 1;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_pool_open(
+	     internal_pool,
+	     entry,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open entry: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reopens a handle in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_reopen(
+     libbfio_pool_t *pool,
+     int entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle               = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_reopen";
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( libbfio_handle_reopen(
+	     handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to reopen handle for entry: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	internal_pool->current_entry  = entry;
+	internal_pool->current_handle = handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libbfio_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Closes a handle in the pool
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_internal_pool_close(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle                             = NULL;
+	libbfio_internal_handle_t *internal_handle           = NULL;
+	libcdata_list_element_t *last_used_list_element      = NULL;
+	libcdata_list_element_t *safe_last_used_list_element = NULL;
+	static char *function                                = "libbfio_internal_pool_close";
+	uint64_t start_timestamp                             = 0;
+	int result                                           = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle for entry: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+/* TODO move into get function */
+		internal_handle = (libbfio_internal_handle_t *) handle;
+
+		last_used_list_element = internal_handle->pool_last_used_list_element;
+
+		if( libcdata_list_element_get_value(
+		     last_used_list_element,
+		     (intptr_t **) &internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from last used list element.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing last used list element value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_list_remove_element(
+		     internal_pool->last_used_list,
+		     last_used_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last used list element from list.",
+			 function );
+
+			goto on_error;
+		}
+		safe_last_used_list_element = last_used_list_element;
+
+		internal_handle->pool_last_used_list_element = NULL;
+
+		if( libcdata_list_element_free(
+		     &safe_last_used_list_element,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free last used list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_pool->trace.is_enabled != 0 )
+	{
+		start_timestamp = libbfio_trace_begin(
+		                   &( internal_pool->trace ),
+		                   LIBBFIO_TRACE_OPERATION_CLOSE,
+		                   entry,
+		                   0,
+		                   0 );
+	}
+	result = libbfio_handle_close(
+	          handle,
+	          error );
+
+	if( internal_pool->trace.is_enabled != 0 )
+	{
+		libbfio_trace_end(
+		 &( internal_pool->trace ),
+		 LIBBFIO_TRACE_OPERATION_CLOSE,
+		 entry,
+		 0,
+		 0,
+		 (int64_t) result,
+		 start_timestamp );
+	}
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle for entry: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( entry == internal_pool->current_entry )
+	{
+		internal_pool->current_entry  = -1;
+		internal_pool->current_handle = NULL;
+	}
+	return( 0 );
+
+on_error:
+	if( safe_last_used_list_element != NULL )
+	{
+		libcdata_list_element_free(
+		 &safe_last_used_list_element,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a handle in the pool
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_pool_close(
+     libbfio_pool_t *pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_close";
+	int result                             = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_pool_close(
+	     internal_pool,
+	     entry,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handle: %d.",
+		 function,
+		 entry );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes all the handles in the pool
+ * If number of threads is larger than 0 and multi-thread support is available
+ * the handles are closed in parallel
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_internal_pool_close_all(
+     libbfio_internal_pool_t *internal_pool,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle                          = NULL;
+	libbfio_internal_handle_t *internal_handle        = NULL;
+	libbfio_internal_pool_close_value_t *close_values = NULL;
+	libcdata_list_element_t *last_used_list_element   = NULL;
+	static char *function                             = "libbfio_internal_pool_close_all";
+	size_t close_values_size                          = 0;
+	int entry                                         = 0;
+	int is_open                                       = 0;
+	int number_of_close_values                        = 0;
+	int number_of_handles                             = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_pool->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_handles == 0 )
+	{
+		return( 0 );
+	}
+	close_values_size = sizeof( libbfio_internal_pool_close_value_t ) * number_of_handles;
+
+	if( close_values_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid close values size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	close_values = (libbfio_internal_pool_close_value_t *) memory_allocate(
+	                                                        close_values_size );
+
+	if( close_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create close values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The open handles are removed from the last used list before they are closed
+	 */
+	for( entry = 0;
+	     entry < number_of_handles;
+	     entry++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_pool->handles_array,
+		     entry,
+		     (intptr_t **) &handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		if( handle == NULL )
+		{
+			continue;
+		}
+		is_open = libbfio_handle_is_open(
+			   handle,
+			   error );
+
+		if( is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if handle: %d is open.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		else if( is_open == 0 )
+		{
+			continue;
+		}
+		internal_handle = (libbfio_internal_handle_t *) handle;
+
+		if( internal_handle->pool_last_used_list_element != NULL )
+		{
+			last_used_list_element = internal_handle->pool_last_used_list_element;
+
+			if( libcdata_list_remove_element(
+			     internal_pool->last_used_list,
+			     last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last used list element from list.",
+				 function );
+
+				goto on_error;
+			}
+			internal_handle->pool_last_used_list_element = NULL;
+
+			internal_pool->number_of_open_handles -= 1;
+
+			if( libcdata_list_element_free(
+			     &last_used_list_element,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free last used list element.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		close_values[ number_of_close_values ].handle = handle;
+		close_values[ number_of_close_values ].result = -1;
+
+		number_of_close_values++;
+	}
+	internal_pool->current_entry  = -1;
+	internal_pool->current_handle = NULL;
+
+	if( libbfio_internal_pool_process_close_values(
+	     close_values,
+	     number_of_close_values,
+	     number_of_threads,
+	     &libbfio_internal_pool_close_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handles.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 close_values );
+
+	return( 0 );
+
+on_error:
+	if( close_values != NULL )
+	{
+		memory_free(
+		 close_values );
+	}
+	return( -1 );
+}
+
+/* Closes a handle in the pool
+ * Callback function for the close all thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_close_handle(
+     libbfio_internal_pool_close_value_t *close_value,
+     void *arguments LIBBFIO_ATTRIBUTE_UNUSED )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	int access_flags                           = 0;
+
+	LIBBFIO_UNREFERENCED_PARAMETER( arguments )
+
+	if( close_value == NULL )
+	{
+		return( -1 );
+	}
+	close_value->result = -1;
+
+	if( close_value->handle == NULL )
+	{
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     close_value->handle,
+	     NULL ) != 0 )
+	{
+		return( -1 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) close_value->handle;
+
+	/* Make sure the truncate flag is removed from the handle
+	 */
+	access_flags = (int) libbfio_atomic_load_int32(
+	                      &( internal_handle->access_flags ) );
+
+	libbfio_atomic_store_int32(
+	 &( internal_handle->access_flags ),
+	 access_flags & ~( LIBBFIO_ACCESS_FLAG_TRUNCATE ) );
+
+	close_value->result = 1;
+
+	return( 1 );
+}
+
+/* Frees a handle in the pool
+ * Callback function for the free thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_free_handle(
+     libbfio_internal_pool_close_value_t *close_value,
+     void *arguments LIBBFIO_ATTRIBUTE_UNUSED )
+{
+	LIBBFIO_UNREFERENCED_PARAMETER( arguments )
+
+	if( close_value == NULL )
+	{
+		return( -1 );
+	}
+	close_value->result = 1;
+
+	if( close_value->handle == NULL )
+	{
+		return( 1 );
+	}
+	if( libbfio_handle_free(
+	     &( close_value->handle ),
+	     NULL ) != 1 )
+	{
+		close_value->result = -1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calls the callback function for each of the close values
+ * If number of threads is larger than 0 and multi-thread support is available
+ * the callback function is called in parallel
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_process_close_values(
+     libbfio_internal_pool_close_value_t *close_values,
+     int number_of_close_values,
+     int number_of_threads,
+     int (*callback_function)(
+            libbfio_internal_pool_close_value_t *close_value,
+            void *arguments ),
+     libcerror_error_t **error )
+{
+	static char *function                  = "libbfio_internal_pool_process_close_values";
+	int close_value_index                  = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( ( close_values == NULL )
+	 && ( number_of_close_values > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid close values.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_close_values <= 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( number_of_threads > number_of_close_values )
+	{
+		number_of_threads = number_of_close_values;
+	}
+	if( number_of_threads > 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_close_values,
+		     (int (*)(intptr_t *, void *)) callback_function,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( close_value_index = 0;
+		     close_value_index < number_of_close_values;
+		     close_value_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( close_values[ close_value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push close value: %d onto thread pool queue.",
+				 function,
+				 close_value_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#else
+	LIBBFIO_UNREFERENCED_PARAMETER( number_of_threads )
+#endif
+	{
+		for( close_value_index = 0;
+		     close_value_index < number_of_close_values;
+		     close_value_index++ )
+		{
+			callback_function(
+			 &( close_values[ close_value_index ] ),
+			 NULL );
+		}
+	}
+	for( close_value_index = 0;
+	     close_value_index < number_of_close_values;
+	     close_value_index++ )
+	{
+		if( close_values[ close_value_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process close value: %d.",
+			 function,
+			 close_value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Closes all the files in the pool
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_pool_close_all(
+     libbfio_pool_t *pool,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_close_all";
+	int result                             = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_pool_close_all(
+	     internal_pool,
+	     0,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handles.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Closes all the files in the pool
+ * If number of threads is larger than 0 and multi-thread support is available
+ * the files are closed in parallel
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_pool_close_all_parallel(
+     libbfio_pool_t *pool,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_close_all_parallel";
+	int result                             = 0;
+
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_internal_pool_wait_for_pre_open(
+	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		libbfio_lock_release_for_write(
+		 internal_pool->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_pool_close_all(
+	     internal_pool,
+	     number_of_threads,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close handles.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+
+/* Opens a handle in advance
+ * This function runs on the pre-open thread and does not access the pool
+ * other than the pre-open values, which are not changed until the pre-open has completed
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_pre_open_callback_function(
+     libbfio_handle_t *handle,
+     libbfio_internal_pool_t *internal_pool )
+{
+	libbfio_internal_handle_t *internal_handle = NULL;
+	int result                                 = -1;
+
+	if( internal_pool == NULL )
+	{
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     handle,
+	     internal_pool->pre_open_access_flags,
+	     NULL ) == 1 )
+	{
+		internal_handle = (libbfio_internal_handle_t *) handle;
+
+		if( libbfio_handle_seek_offset(
+		     handle,
+		     internal_handle->current_offset,
+		     SEEK_SET,
+		     NULL ) != -1 )
+		{
+			if( internal_pool->pre_open_handle_prefetch_size > 0 )
+			{
+				/* The prefetch is only a hint, hence failure is not an error
+				 */
+				libbfio_handle_prefetch(
+				 handle,
+				 0,
+				 internal_pool->pre_open_handle_prefetch_size,
+				 NULL );
+			}
+			result = 1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     internal_pool->pre_open_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_pool->pre_open_result     = result;
+	internal_pool->pre_open_is_pending = 0;
+
+	libcthreads_condition_broadcast(
+	 internal_pool->pre_open_condition,
+	 NULL );
+
+	if( libcthreads_mutex_release(
+	     internal_pool->pre_open_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	/* A failed pre-open is reported by the pre-open result
+	 */
+	return( 1 );
+}
+
+/* Opens a handle in the pool in advance on the pre-open thread
+ * The handle is accounted for in the last used list before the pre-open is queued
+ * Returns 1 if successful, 0 if the handle was not pre-opened or -1 on error
+ */
+int libbfio_internal_pool_pre_open_handle(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle                        = NULL;
+	libbfio_handle_t *last_used_handle              = NULL;
+	libbfio_internal_handle_t *internal_handle      = NULL;
+	libcdata_list_element_t *last_used_list_element = NULL;
+	static char *function                           = "libbfio_internal_pool_pre_open_handle";
+	int access_flags                                = 0;
+	int number_of_handles                           = 0;
+	int is_open                                     = 0;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->pre_open_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool - pre-open handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_pool->handles_array,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry < 0 )
+	 || ( entry >= number_of_handles ) )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
+	     entry,
+	     (intptr_t **) &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		return( 0 );
+	}
+	internal_handle = (libbfio_internal_handle_t *) handle;
+
+	/* A handle without a read/write lock, such as a single threaded handle,
+	 * cannot be accessed by the pre-open thread safely
+	 */
+	if( internal_handle->read_write_lock == NULL )
+	{
+		return( 0 );
+	}
+	is_open = libbfio_handle_is_open(
+	           handle,
+	           error );
+
+	if( is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if entry: %d is open.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	else if( is_open != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+		/* Do not pre-open the handle if that requires the current handle to be closed
+		 */
+		if( ( internal_pool->number_of_open_handles + 1 ) >= internal_pool->maximum_number_of_open_handles )
+		{
+			if( libcdata_list_get_last_element(
+			     internal_pool->last_used_list,
+			     &last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve last list element from last used list.",
+				 function );
+
+				return( -1 );
+			}
+			if( last_used_list_element == NULL )
+			{
+				return( 0 );
+			}
+			if( libcdata_list_element_get_value(
+			     last_used_list_element,
+			     (intptr_t **) &last_used_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value from last used list element.",
+				 function );
+
+				return( -1 );
+			}
+			if( last_used_handle == internal_pool->current_handle )
+			{
+				return( 0 );
+			}
+		}
+	}
+	if( libbfio_handle_get_access_flags(
+	     handle,
+	     &access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+		if( libbfio_internal_pool_append_handle_to_last_used_list(
+		     internal_pool,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append handle to last used list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The pre-open thread is created once and reused for every pre-open
+	 */
+	if( internal_pool->pre_open_thread_pool == NULL )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( internal_pool->pre_open_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pre-open mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( internal_pool->pre_open_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pre-open condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( internal_pool->pre_open_thread_pool ),
+		     NULL,
+		     1,
+		     1,
+		     (int (*)(intptr_t *, void *)) &libbfio_internal_pool_pre_open_callback_function,
+		     (void *) internal_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pre-open thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_pool->pre_open_handle               = handle;
+	internal_pool->pre_open_access_flags         = access_flags;
+	internal_pool->pre_open_handle_prefetch_size = internal_pool->pre_open_prefetch_size;
+	internal_pool->pre_open_result               = 0;
+	internal_pool->pre_open_is_pending           = 1;
+
+	if( libcthreads_thread_pool_push(
+	     internal_pool->pre_open_thread_pool,
+	     (intptr_t *) handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push handle onto pre-open thread pool queue.",
+		 function );
+
+		internal_pool->pre_open_is_pending = 0;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	internal_pool->pre_open_handle = NULL;
+
+	if( internal_pool->pre_open_thread_pool == NULL )
+	{
+		if( internal_pool->pre_open_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_pool->pre_open_condition ),
+			 NULL );
+		}
+		if( internal_pool->pre_open_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_pool->pre_open_mutex ),
+			 NULL );
+		}
+	}
+
+	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+		if( internal_handle->pool_last_used_list_element != NULL )
+		{
+			last_used_list_element = internal_handle->pool_last_used_list_element;
+
+			internal_handle->pool_last_used_list_element = NULL;
+
+			if( libcdata_list_remove_element(
+			     internal_pool->last_used_list,
+			     last_used_list_element,
+			     NULL ) == 1 )
+			{
+				libcdata_list_element_free(
+				 &last_used_list_element,
+				 NULL,
+				 NULL );
+
+				internal_pool->number_of_open_handles--;
+			}
+		}
+	}
+	return( -1 );
+}
+
+/* Waits for the queued pre-open to complete
+ * If the handle could not be opened its last used list accounting is reverted
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_wait_for_pre_open(
+     libbfio_internal_pool_t *internal_pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *handle                        = NULL;
+	libbfio_internal_handle_t *internal_handle      = NULL;
+	libcdata_list_element_t *last_used_list_element = NULL;
+	static char *function                           = "libbfio_internal_pool_wait_for_pre_open";
+	int result                                      = 1;
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pool->pre_open_handle == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_pool->pre_open_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab pre-open mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_pool->pre_open_is_pending != 0 )
+	{
+		if( libcthreads_condition_wait(
+		     internal_pool->pre_open_condition,
+		     internal_pool->pre_open_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for pre-open condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 internal_pool->pre_open_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_pool->pre_open_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release pre-open mutex.",
+		 function );
+
+		return( -1 );
+	}
+	handle = internal_pool->pre_open_handle;
+
+	internal_pool->pre_open_handle = NULL;
+
+	if( internal_pool->pre_open_result == 1 )
+	{
+		return( 1 );
+	}
+	/* The entry is opened on demand when it is accessed
+	 */
+	if( libbfio_handle_is_open(
+	     handle,
+	     NULL ) == 1 )
+	{
+		if( libbfio_handle_close(
+		     handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close pre-opened handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	{
+		internal_handle = (libbfio_internal_handle_t *) handle;
+
+		last_used_list_element = internal_handle->pool_last_used_list_element;
+
+		if( last_used_list_element != NULL )
+		{
+			if( libcdata_list_remove_element(
+			     internal_pool->last_used_list,
+			     last_used_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove last used list element from list.",
+				 function );
+
+				return( -1 );
+			}
+			internal_handle->pool_last_used_list_element = NULL;
+
+			if( libcdata_list_element_free(
+			     &last_used_list_element,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free last used list element.",
+				 function );
+
+				result = -1;
+			}
+			internal_pool->number_of_open_handles--;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO ) */
+
+/* Retrieves a specific handle from the pool and opens it if needed
+ * If the pool has a descriptor manager the handle is acquired and
+ * must be released after use
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_pool_get_open_handle(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libbfio_handle_t **handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *safe_handle = NULL;
+	static char *function         = "libbfio_internal_pool_get_open_handle";
+	uint8_t descriptor_acquired   = 0;
+	int access_flags              = 0;
+	int is_open                   = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	uint8_t is_sequential         = 0;
+#endif
+
+	if( internal_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* With a descriptor manager the current handle can have been closed
+	 * by another user of the descriptor manager
+	 */
+	if( ( entry != internal_pool->current_entry )
+	 || ( internal_pool->descriptor_manager != NULL ) )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libbfio_internal_pool_wait_for_pre_open(
+		     internal_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to wait for pre-open.",
+			 function );
+
+			return( -1 );
+		}
+		/* The first entry accessed or the entry after the current entry starts or continues sequential access
+		 */
+		is_sequential = (uint8_t) ( ( internal_pool->current_entry < 0 ) || ( entry == ( internal_pool->current_entry + 1 ) ) );
+#endif
+		if( libcdata_array_get_entry_by_index(
+		     internal_pool->handles_array,
+		     entry,
+		     (intptr_t **) &safe_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 entry );
+
+			return( -1 );
+		}
+		/* The handle remains acquired, so that it is not closed by another user
+		 * of the descriptor manager, until it is released after use
+		 */
+		if( internal_pool->descriptor_manager != NULL )
+		{
+			if( libbfio_descriptor_manager_acquire_handle(
+			     internal_pool->descriptor_manager,
+			     safe_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to acquire handle: %d from descriptor manager.",
+				 function,
+				 entry );
+
+				return( -1 );
+			}
+			descriptor_acquired = 1;
+		}
+		/* Make sure the handle is open
+		 */
+		is_open = libbfio_handle_is_open(
+		           safe_handle,
+		           error );
+
+		if( is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if entry: %d is open.",
+			 function,
+			 entry );
+
+			goto on_error;
+		}
+		else if( is_open == 0 )
+		{
+			if( libbfio_handle_get_access_flags(
+			     safe_handle,
+			     &access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve access flags.",
+				 function );
+
+				goto on_error;
+			}
+			if( libbfio_internal_pool_open_handle(
+			     internal_pool,
+			     entry,
+			     safe_handle,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open entry: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+		}
+		if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+		{
+			if( libbfio_internal_pool_move_handle_to_front_of_last_used_list(
+			     internal_pool,
+			     safe_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to move handle to front of last used list.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( libcdata_list_remove_element(
-		     internal_pool->last_used_list,
-		     last_used_list_element,
-		     error ) != 1 )
+		internal_pool->current_entry  = entry;
+		internal_pool->current_handle = safe_handle;
+
+		if( internal_pool->adaptive_maximum_number_of_open_handles != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-			 "%s: unable to remove last used list element from list.",
-			 function );
+			internal_pool->adaptive_number_of_accesses++;
 
-			goto on_error;
-		}
-		safe_last_used_list_element = last_used_list_element;
+			if( is_open == 0 )
+			{
+				internal_pool->adaptive_number_of_reopens++;
+			}
+			if( internal_pool->adaptive_number_of_accesses >= LIBBFIO_POOL_ADAPTIVE_NUMBER_OF_ACCESSES )
+			{
+				if( libbfio_internal_pool_adapt_maximum_number_of_open_handles(
+				     internal_pool,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to adapt maximum number of open handles.",
+					 function );
 
-		internal_handle->pool_last_used_list_element = NULL;
+					goto on_error;
+				}
+			}
+		}
 
-		if( libcdata_list_element_free(
-		     &safe_last_used_list_element,
-		     NULL,
-		     error ) != 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		/* A pre-opened handle is not accounted for by the descriptor manager
+		 */
+		if( ( internal_pool->pre_open_next_entry != 0 )
+		 && ( internal_pool->descriptor_manager == NULL )
+		 && ( is_sequential != 0 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free last used list element.",
-			 function );
+			if( libbfio_internal_pool_pre_open_handle(
+			     internal_pool,
+			     entry + 1,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to pre-open entry: %d.",
+				 function,
+				 entry + 1 );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
+#endif
 	}
-	if( libbfio_handle_close(
-	     handle,
-	     error ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close handle for entry: %d.",
-		 function,
-		 entry );
+	*handle = internal_pool->current_handle;
 
-		goto on_error;
-	}
-	if( entry == internal_pool->current_entry )
-	{
-		internal_pool->current_entry  = -1;
-		internal_pool->current_handle = NULL;
-	}
-	return( 0 );
+	return( 1 );
 
 on_error:
-	if( safe_last_used_list_element != NULL )
+	if( descriptor_acquired != 0 )
 	{
-		libcdata_list_element_free(
-		 &safe_last_used_list_element,
-		 NULL,
+		libbfio_descriptor_manager_release_handle(
+		 internal_pool->descriptor_manager,
+		 safe_handle,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Closes a handle in the pool
- * Returns 0 if successful or -1 on error
+/* Reads data at the current offset into the buffer
+ * Returns the number of bytes read or -1 on error
  */
-int libbfio_pool_close(
-     libbfio_pool_t *pool,
-     int entry,
-     libcerror_error_t **error )
+ssize_t libbfio_pool_read_buffer(
+         libbfio_pool_t *pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
 {
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_close";
-	int result                             = 0;
+	libbfio_handle_t *handle                   = NULL;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_internal_pool_t *internal_pool     = NULL;
+	libcerror_error_t **read_error             = NULL;
+	static char *function                      = "libbfio_pool_read_buffer";
+	ssize_t read_count                         = 0;
+	off64_t trace_offset                       = 0;
+	uint64_t start_timestamp                   = 0;
 
 	if( pool == NULL )
 	{
@@ -2516,7 +6967,7 @@ int libbfio_pool_close(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2530,23 +6981,120 @@ int libbfio_pool_close(
 		return( -1 );
 	}
 #endif
-	if( libbfio_internal_pool_close(
+	internal_pool->last_error_domain = 0;
+	internal_pool->last_error_code   = 0;
+
+	/* In lightweight error mode the error is not set, which prevents
+	 * the error messages of all the layers from being formatted
+	 */
+	if( internal_pool->error_mode == LIBBFIO_ERROR_MODE_LIGHTWEIGHT )
+	{
+		read_error = NULL;
+	}
+	else
+	{
+		read_error = error;
+	}
+	if( libbfio_internal_pool_get_open_handle(
 	     internal_pool,
 	     entry,
-	     error ) != 0 )
+	     &handle,
+	     read_error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close handle: %d.",
+		 read_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
 		 function,
 		 entry );
 
-		result = -1;
+		if( internal_pool->last_error_domain == 0 )
+		{
+			internal_pool->last_error_domain = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+			internal_pool->last_error_code   = LIBCERROR_RUNTIME_ERROR_GET_FAILED;
+		}
+		read_count = -1;
+	}
+	else
+	{
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			libbfio_handle_get_offset(
+			 handle,
+			 &trace_offset,
+			 NULL );
+
+			start_timestamp = libbfio_trace_begin(
+			                   &( internal_pool->trace ),
+			                   LIBBFIO_TRACE_OPERATION_READ,
+			                   entry,
+			                   trace_offset,
+			                   (size64_t) size );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              buffer,
+		              size,
+		              read_error );
+
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			libbfio_trace_end(
+			 &( internal_pool->trace ),
+			 LIBBFIO_TRACE_OPERATION_READ,
+			 entry,
+			 trace_offset,
+			 (size64_t) size,
+			 (int64_t) read_count,
+			 start_timestamp );
+		}
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 read_error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d.",
+			 function,
+			 entry );
+
+			internal_handle = (libbfio_internal_handle_t *) handle;
+
+			if( internal_handle->last_error_domain != 0 )
+			{
+				internal_pool->last_error_domain = internal_handle->last_error_domain;
+				internal_pool->last_error_code   = internal_handle->last_error_code;
+			}
+			else
+			{
+				internal_pool->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+				internal_pool->last_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+			}
+			read_count = -1;
+		}
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
+			 function,
+			 entry );
+
+			read_count = -1;
+		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2560,22 +7108,27 @@ int libbfio_pool_close(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( read_count );
 }
 
-/* Closes all the files in the pool
- * Returns 0 if successful or -1 on error
+/* Reads data at a specific offset into the buffer
+ * Returns the number of bytes read or -1 on error
  */
-int libbfio_pool_close_all(
-     libbfio_pool_t *pool,
-     libcerror_error_t **error )
+ssize_t libbfio_pool_read_buffer_at_offset(
+         libbfio_pool_t *pool,
+         int entry,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	libbfio_handle_t *handle               = NULL;
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_close_all";
-	int entry                              = 0;
-	int is_open                            = 0;
-	int number_of_handles                  = 0;
+	libbfio_handle_t *handle                   = NULL;
+	libbfio_internal_handle_t *internal_handle = NULL;
+	libbfio_internal_pool_t *internal_pool     = NULL;
+	libcerror_error_t **read_error             = NULL;
+	static char *function                      = "libbfio_pool_read_buffer_at_offset";
+	ssize_t read_count                         = 0;
+	uint64_t start_timestamp                   = 0;
 
 	if( pool == NULL )
 	{
@@ -2591,7 +7144,7 @@ int libbfio_pool_close_all(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2605,84 +7158,118 @@ int libbfio_pool_close_all(
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_number_of_entries(
-	     internal_pool->handles_array,
-	     &number_of_handles,
-	     error ) != 1 )
+	internal_pool->last_error_domain = 0;
+	internal_pool->last_error_code   = 0;
+
+	/* In lightweight error mode the error is not set, which prevents
+	 * the error messages of all the layers from being formatted
+	 */
+	if( internal_pool->error_mode == LIBBFIO_ERROR_MODE_LIGHTWEIGHT )
+	{
+		read_error = NULL;
+	}
+	else
+	{
+		read_error = error;
+	}
+	if( libbfio_internal_pool_get_open_handle(
+	     internal_pool,
+	     entry,
+	     &handle,
+	     read_error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
+		 read_error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of handles.",
-		 function );
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
 
-		goto on_error;
-	}
-	for( entry = 0;
-	     entry < number_of_handles;
-	     entry++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_pool->handles_array,
-		     entry,
-		     (intptr_t **) &handle,
-		     error ) != 1 )
+		if( internal_pool->last_error_domain == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve handle: %d.",
-			 function,
-			 entry );
-
-			goto on_error;
+			internal_pool->last_error_domain = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+			internal_pool->last_error_code   = LIBCERROR_RUNTIME_ERROR_GET_FAILED;
 		}
-		if( handle == NULL )
+		read_count = -1;
+	}
+	else
+	{
+		if( internal_pool->trace.is_enabled != 0 )
 		{
-			continue;
+			start_timestamp = libbfio_trace_begin(
+			                   &( internal_pool->trace ),
+			                   LIBBFIO_TRACE_OPERATION_READ,
+			                   entry,
+			                   offset,
+			                   (size64_t) size );
 		}
-		/* Make sure the handle is open
-		 */
-		is_open = libbfio_handle_is_open(
-			   handle,
-			   error );
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              size,
+		              offset,
+		              read_error );
 
-		if( is_open == -1 )
+		if( internal_pool->trace.is_enabled != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if handle: %d is open.",
-			 function,
-			 entry );
-
-			goto on_error;
+			libbfio_trace_end(
+			 &( internal_pool->trace ),
+			 LIBBFIO_TRACE_OPERATION_READ,
+			 entry,
+			 offset,
+			 (size64_t) size,
+			 (int64_t) read_count,
+			 start_timestamp );
 		}
-		else if( is_open == 0 )
+		if( read_count < 0 )
 		{
-			continue;
+			libcerror_error_set(
+			 read_error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry,
+			 offset,
+			 offset );
+
+			internal_handle = (libbfio_internal_handle_t *) handle;
+
+			if( internal_handle->last_error_domain != 0 )
+			{
+				internal_pool->last_error_domain = internal_handle->last_error_domain;
+				internal_pool->last_error_code   = internal_handle->last_error_code;
+			}
+			else
+			{
+				internal_pool->last_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+				internal_pool->last_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+			}
+			read_count = -1;
 		}
-		if( libbfio_internal_pool_close(
-		     internal_pool,
-		     entry,
-		     error ) != 0 )
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close handle: %d.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
 			 function,
 			 entry );
 
-			goto on_error;
+			read_count = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2696,32 +7283,27 @@ int libbfio_pool_close_all(
 		return( -1 );
 	}
 #endif
-	return( 0 );
-
-on_error:
-#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_pool->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( read_count );
 }
 
-/* Retrieves a specific handle from the pool and opens it if needed
- * Returns 1 if successful or -1 on error
+/* Writes data at the current offset from the buffer
+ * Returns the number of bytes written or -1 on error
  */
-int libbfio_internal_pool_get_open_handle(
-     libbfio_internal_pool_t *internal_pool,
-     int entry,
-     libbfio_handle_t **handle,
-     libcerror_error_t **error )
+ssize_t libbfio_pool_write_buffer(
+         libbfio_pool_t *pool,
+         int entry,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
 {
-	libbfio_handle_t *safe_handle = NULL;
-	static char *function         = "libbfio_internal_pool_get_open_handle";
-	int access_flags              = 0;
-	int is_open                   = 0;
+	libbfio_handle_t *handle               = NULL;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_write_buffer";
+	ssize_t write_count                    = 0;
+	off64_t trace_offset                   = 0;
+	uint64_t start_timestamp               = 0;
 
-	if( internal_pool == NULL )
+	if( pool == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2732,125 +7314,138 @@ int libbfio_internal_pool_get_open_handle(
 
 		return( -1 );
 	}
-	if( handle == NULL )
+	internal_pool = (libbfio_internal_pool_t *) pool;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_grab_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry != internal_pool->current_entry )
+#endif
+	if( libbfio_internal_pool_get_open_handle(
+	     internal_pool,
+	     entry,
+	     &handle,
+	     error ) != 1 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_pool->handles_array,
-		     entry,
-		     (intptr_t **) &safe_handle,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle: %d.",
+		 function,
+		 entry );
+
+		write_count = -1;
+	}
+	else
+	{
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			libbfio_handle_get_offset(
+			 handle,
+			 &trace_offset,
+			 NULL );
+
+			start_timestamp = libbfio_trace_begin(
+			                   &( internal_pool->trace ),
+			                   LIBBFIO_TRACE_OPERATION_WRITE,
+			                   entry,
+			                   trace_offset,
+			                   (size64_t) size );
+		}
+		write_count = libbfio_handle_write_buffer(
+		               handle,
+		               buffer,
+		               size,
+		               error );
+
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			libbfio_trace_end(
+			 &( internal_pool->trace ),
+			 LIBBFIO_TRACE_OPERATION_WRITE,
+			 entry,
+			 trace_offset,
+			 (size64_t) size,
+			 (int64_t) write_count,
+			 start_timestamp );
+		}
+		if( write_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve handle: %d.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to entry: %d.",
 			 function,
 			 entry );
 
-			return( -1 );
+			write_count = -1;
 		}
-		/* Make sure the handle is open
-		 */
-		is_open = libbfio_handle_is_open(
-		           safe_handle,
-		           error );
-
-		if( is_open == -1 )
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if entry: %d is open.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
 			 function,
 			 entry );
 
-			return( -1 );
-		}
-		else if( is_open == 0 )
-		{
-			if( libbfio_handle_get_access_flags(
-			     safe_handle,
-			     &access_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve access flags.",
-				 function );
-
-				return( -1 );
-			}
-			if( libbfio_internal_pool_open_handle(
-			     internal_pool,
-			     safe_handle,
-			     access_flags,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_OPEN_FAILED,
-				 "%s: unable to open entry: %d.",
-				 function,
-				 entry );
-
-				return( -1 );
-			}
-		}
-		if( internal_pool->maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
-		{
-			if( libbfio_internal_pool_move_handle_to_front_of_last_used_list(
-			     internal_pool,
-			     safe_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to move handle to front of last used list.",
-				 function );
-
-				return( -1 );
-			}
+			write_count = -1;
 		}
-		internal_pool->current_entry  = entry;
-		internal_pool->current_handle = safe_handle;
 	}
-	*handle = internal_pool->current_handle;
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libbfio_lock_release_for_write(
+	     internal_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#endif
+	return( write_count );
 }
 
-/* Reads data at the current offset into the buffer
- * Returns the number of bytes read or -1 on error
+/* Writes data at a specific offset from the buffer
+ * Returns the number of bytes written or -1 on error
  */
-ssize_t libbfio_pool_read_buffer(
+ssize_t libbfio_pool_write_buffer_at_offset(
          libbfio_pool_t *pool,
          int entry,
-         uint8_t *buffer,
+         const uint8_t *buffer,
          size_t size,
+         off64_t offset,
          libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_read_buffer";
-	ssize_t read_count                     = 0;
+	static char *function                  = "libbfio_pool_write_buffer_at_offset";
+	ssize_t write_count                    = 0;
+	uint64_t start_timestamp               = 0;
 
 	if( pool == NULL )
 	{
@@ -2866,7 +7461,7 @@ ssize_t libbfio_pool_read_buffer(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2894,31 +7489,73 @@ ssize_t libbfio_pool_read_buffer(
 		 function,
 		 entry );
 
-		read_count = -1;
+		write_count = -1;
 	}
 	else
 	{
-		read_count = libbfio_handle_read_buffer(
-		              handle,
-		              buffer,
-		              size,
-		              error );
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			start_timestamp = libbfio_trace_begin(
+			                   &( internal_pool->trace ),
+			                   LIBBFIO_TRACE_OPERATION_WRITE,
+			                   entry,
+			                   offset,
+			                   (size64_t) size );
+		}
+		write_count = libbfio_handle_write_buffer_at_offset(
+		               handle,
+		               buffer,
+		               size,
+		               offset,
+		               error );
 
-		if( read_count < 0 )
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			libbfio_trace_end(
+			 &( internal_pool->trace ),
+			 LIBBFIO_TRACE_OPERATION_WRITE,
+			 entry,
+			 offset,
+			 (size64_t) size,
+			 (int64_t) write_count,
+			 start_timestamp );
+		}
+		if( write_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from entry: %d.",
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 entry,
+			 offset,
+			 offset );
+
+			write_count = -1;
+		}
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
 			 function,
 			 entry );
 
-			read_count = -1;
+			write_count = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2932,24 +7569,24 @@ ssize_t libbfio_pool_read_buffer(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( write_count );
 }
 
-/* Reads data at a specific offset into the buffer
- * Returns the number of bytes read or -1 on error
+/* Seeks an offset in a handle in the pool
+ * Returns the offset if successful or -1 on error
  */
-ssize_t libbfio_pool_read_buffer_at_offset(
+off64_t libbfio_pool_seek_offset(
          libbfio_pool_t *pool,
          int entry,
-         uint8_t *buffer,
-         size_t size,
          off64_t offset,
+         int whence,
          libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_read_buffer_at_offset";
-	ssize_t read_count                     = 0;
+	static char *function                  = "libbfio_pool_seek_offset";
+	off64_t trace_offset                   = 0;
+	uint64_t start_timestamp               = 0;
 
 	if( pool == NULL )
 	{
@@ -2965,7 +7602,7 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2993,34 +7630,72 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 		 function,
 		 entry );
 
-		read_count = -1;
+		offset = -1;
 	}
 	else
 	{
-		read_count = libbfio_handle_read_buffer_at_offset(
-		              handle,
-		              buffer,
-		              size,
-		              offset,
-		              error );
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			trace_offset = offset;
+
+			start_timestamp = libbfio_trace_begin(
+			                   &( internal_pool->trace ),
+			                   LIBBFIO_TRACE_OPERATION_SEEK,
+			                   entry,
+			                   trace_offset,
+			                   0 );
+		}
+		offset = libbfio_handle_seek_offset(
+		          handle,
+		          offset,
+		          whence,
+		          error );
 
-		if( read_count < 0 )
+		if( internal_pool->trace.is_enabled != 0 )
+		{
+			libbfio_trace_end(
+			 &( internal_pool->trace ),
+			 LIBBFIO_TRACE_OPERATION_SEEK,
+			 entry,
+			 trace_offset,
+			 0,
+			 (int64_t) offset,
+			 start_timestamp );
+		}
+		if( offset == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in entry: %d.",
 			 function,
-			 entry,
-			 offset,
-			 offset );
+			 entry );
 
-			read_count = -1;
+			offset = -1;
+		}
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
+			 function,
+			 entry );
+
+			offset = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3034,23 +7709,22 @@ ssize_t libbfio_pool_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( offset );
 }
 
-/* Writes data at the current offset from the buffer
- * Returns the number of bytes written or -1 on error
+/* Retrieves the current offset in a handle in the pool
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_pool_write_buffer(
-         libbfio_pool_t *pool,
-         int entry,
-         const uint8_t *buffer,
-         size_t size,
-         libcerror_error_t **error )
+int libbfio_pool_get_offset(
+     libbfio_pool_t *pool,
+     int entry,
+     off64_t *offset,
+     libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_write_buffer";
-	ssize_t write_count                    = 0;
+	static char *function                  = "libbfio_pool_get_offset";
+	int result                             = 1;
 
 	if( pool == NULL )
 	{
@@ -3066,7 +7740,7 @@ ssize_t libbfio_pool_write_buffer(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3094,31 +7768,46 @@ ssize_t libbfio_pool_write_buffer(
 		 function,
 		 entry );
 
-		write_count = -1;
+		result = -1;
 	}
 	else
 	{
-		write_count = libbfio_handle_write_buffer(
-		               handle,
-		               buffer,
-		               size,
-		               error );
+		if( libbfio_handle_get_offset(
+		     handle,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset.",
+			 function );
 
-		if( write_count < 0 )
+			result = -1;
+		}
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to entry: %d.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
 			 function,
 			 entry );
 
-			write_count = -1;
+			result = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3132,24 +7821,22 @@ ssize_t libbfio_pool_write_buffer(
 		return( -1 );
 	}
 #endif
-	return( write_count );
+	return( result );
 }
 
-/* Writes data at a specific offset from the buffer
- * Returns the number of bytes written or -1 on error
+/* Retrieves the size of a handle in the pool
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libbfio_pool_write_buffer_at_offset(
-         libbfio_pool_t *pool,
-         int entry,
-         const uint8_t *buffer,
-         size_t size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libbfio_pool_get_size(
+     libbfio_pool_t *pool,
+     int entry,
+     size64_t *size,
+     libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_write_buffer_at_offset";
-	ssize_t write_count                    = 0;
+	static char *function                  = "libbfio_pool_get_size";
+	int result                             = 1;
 
 	if( pool == NULL )
 	{
@@ -3165,7 +7852,7 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3193,34 +7880,47 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 		 function,
 		 entry );
 
-		write_count = -1;
+		result = -1;
 	}
 	else
 	{
-		write_count = libbfio_handle_write_buffer_at_offset(
-		               handle,
-		               buffer,
-		               size,
-		               offset,
-		               error );
+		if( libbfio_handle_get_size(
+		     handle,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of entry: %d.",
+			 function,
+			 entry );
 
-		if( write_count < 0 )
+			result = -1;
+		}
+	}
+	if( ( handle != NULL )
+	 && ( internal_pool->descriptor_manager != NULL ) )
+	{
+		if( libbfio_descriptor_manager_release_handle(
+		     internal_pool->descriptor_manager,
+		     handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release handle: %d from descriptor manager.",
 			 function,
-			 entry,
-			 offset,
-			 offset );
+			 entry );
 
-			write_count = -1;
+			result = -1;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3234,22 +7934,26 @@ ssize_t libbfio_pool_write_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	return( write_count );
+	return( result );
 }
 
-/* Seeks an offset in a handle in the pool
- * Returns the offset if successful or -1 on error
+/* Prefetches data of a handle in the pool
+ * The function returns immediately and the data is read asynchronously
+ * by the operating system. The handle is not opened
+ * The pool is locked for writing since the handle can be single threaded
+ * Returns 1 if successful, 0 if not supported or -1 on error
  */
-off64_t libbfio_pool_seek_offset(
-         libbfio_pool_t *pool,
-         int entry,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libbfio_pool_prefetch(
+     libbfio_pool_t *pool,
+     int entry,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
 	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_seek_offset";
+	static char *function                  = "libbfio_pool_prefetch";
+	int result                             = 0;
 
 	if( pool == NULL )
 	{
@@ -3265,7 +7969,7 @@ off64_t libbfio_pool_seek_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3278,11 +7982,24 @@ off64_t libbfio_pool_seek_offset(
 
 		return( -1 );
 	}
-#endif
-	if( libbfio_internal_pool_get_open_handle(
+	if( libbfio_internal_pool_wait_for_pre_open(
 	     internal_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_pool->handles_array,
 	     entry,
-	     &handle,
+	     (intptr_t **) &handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3293,31 +8010,40 @@ off64_t libbfio_pool_seek_offset(
 		 function,
 		 entry );
 
-		offset = -1;
+		goto on_error;
 	}
-	else
+	if( handle == NULL )
 	{
-		offset = libbfio_handle_seek_offset(
-		          handle,
-		          offset,
-		          whence,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool - missing handle: %d.",
+		 function,
+		 entry );
 
-		if( offset == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset in entry: %d.",
-			 function,
-			 entry );
+		goto on_error;
+	}
+	result = libbfio_handle_prefetch(
+	          handle,
+	          offset,
+	          size,
+	          error );
 
-			offset = -1;
-		}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to prefetch data of handle: %d.",
+		 function,
+		 entry );
+
+		goto on_error;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3331,22 +8057,35 @@ off64_t libbfio_pool_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libbfio_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the current offset in a handle in the pool
+/* Passes an access hint to all the handles in the pool
+ * The offset and size are relative to the start of each handle
+ * Handles that do not support access hints are ignored
+ * The pool is locked for writing since the handles can be single threaded
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_get_offset(
+int libbfio_pool_set_access_hint(
      libbfio_pool_t *pool,
-     int entry,
-     off64_t *offset,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
      libcerror_error_t **error )
 {
 	libbfio_handle_t *handle               = NULL;
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_offset";
-	int result                             = 1;
+	libbfio_internal_pool_t *internal_pool = NULL;
+	static char *function                  = "libbfio_pool_set_access_hint";
+	int entry                              = 0;
+	int number_of_handles                  = 0;
 
 	if( pool == NULL )
 	{
@@ -3362,7 +8101,7 @@ int libbfio_pool_get_offset(
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3375,42 +8114,78 @@ int libbfio_pool_get_offset(
 
 		return( -1 );
 	}
-#endif
-	if( libbfio_internal_pool_get_open_handle(
+	if( libbfio_internal_pool_wait_for_pre_open(
 	     internal_pool,
-	     entry,
-	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_pool->handles_array,
+	     &number_of_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 "%s: unable to retrieve number of handles.",
+		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	else
+	for( entry = 0;
+	     entry < number_of_handles;
+	     entry++ )
 	{
-		if( libbfio_handle_get_offset(
-		     handle,
-		     offset,
+		if( libcdata_array_get_entry_by_index(
+		     internal_pool->handles_array,
+		     entry,
+		     (intptr_t **) &handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset.",
-			 function );
+			 "%s: unable to retrieve handle: %d.",
+			 function,
+			 entry );
 
-			result = -1;
+			goto on_error;
+		}
+		if( handle == NULL )
+		{
+			continue;
+		}
+		if( libbfio_handle_set_access_hint(
+		     handle,
+		     access_hint,
+		     offset,
+		     size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access hint of handle: %d.",
+			 function,
+			 entry );
+
+			goto on_error;
 		}
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3424,22 +8199,113 @@ int libbfio_pool_get_offset(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libbfio_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the size of a handle in the pool
+
+/* Checks a handle in the pool
+ * Determines if the handle exists and retrieves its size, which is cached by the handle
+ * Callback function for the check handles thread pool
  * Returns 1 if successful or -1 on error
  */
-int libbfio_pool_get_size(
+int libbfio_internal_pool_check_handle(
+     libbfio_internal_pool_check_value_t *check_value,
+     void *arguments LIBBFIO_ATTRIBUTE_UNUSED )
+{
+	size64_t size = 0;
+	int is_open   = 0;
+	int result    = 0;
+
+	LIBBFIO_UNREFERENCED_PARAMETER( arguments )
+
+	if( check_value == NULL )
+	{
+		return( -1 );
+	}
+	check_value->result = 0;
+
+	if( check_value->handle == NULL )
+	{
+		check_value->result = 1;
+
+		return( 1 );
+	}
+	is_open = libbfio_handle_is_open(
+	           check_value->handle,
+	           NULL );
+
+	if( is_open == -1 )
+	{
+		return( -1 );
+	}
+	else if( is_open == 0 )
+	{
+		if( libbfio_handle_exists(
+		     check_value->handle,
+		     NULL ) != 1 )
+		{
+			return( 1 );
+		}
+		if( libbfio_handle_open(
+		     check_value->handle,
+		     LIBBFIO_OPEN_READ,
+		     NULL ) != 1 )
+		{
+			return( 1 );
+		}
+	}
+	result = libbfio_handle_get_size(
+	          check_value->handle,
+	          &size,
+	          NULL );
+
+	if( is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     check_value->handle,
+		     NULL ) != 0 )
+		{
+			return( -1 );
+		}
+	}
+	if( result == 1 )
+	{
+		check_value->result = 1;
+	}
+	return( 1 );
+}
+
+/* Checks the handles in the pool
+ * Determines if the handles exist and retrieves their sizes, which are cached by the handles
+ * Handles that are not open are opened for reading and closed afterwards
+ * If number of threads is larger than 0 and multi-thread support is available
+ * the handles are checked in parallel
+ * Returns 1 if all handles were successfully checked, 0 if not or -1 on error
+ */
+int libbfio_pool_check_handles(
      libbfio_pool_t *pool,
-     int entry,
-     size64_t *size,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *handle               = NULL;
-	libbfio_internal_pool_t *internal_pool = NULL;
-	static char *function                  = "libbfio_pool_get_size";
-	int result                             = 1;
+	libbfio_internal_pool_check_value_t *check_values = NULL;
+	libbfio_internal_pool_t *internal_pool            = NULL;
+	static char *function                             = "libbfio_pool_check_handles";
+	size_t check_values_size                          = 0;
+	int entry                                         = 0;
+	int number_of_handles                             = 0;
+	int result                                        = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_thread_pool_t *thread_pool            = NULL;
+#endif
 
 	if( pool == NULL )
 	{
@@ -3454,8 +8320,19 @@ int libbfio_pool_get_size(
 	}
 	internal_pool = (libbfio_internal_pool_t *) pool;
 
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libbfio_lock_grab_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3468,43 +8345,181 @@ int libbfio_pool_get_size(
 
 		return( -1 );
 	}
-#endif
-	if( libbfio_internal_pool_get_open_handle(
+	if( libbfio_internal_pool_wait_for_pre_open(
 	     internal_pool,
-	     entry,
-	     &handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to wait for pre-open.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_pool->handles_array,
+	     &number_of_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve handle: %d.",
-		 function,
-		 entry );
+		 "%s: unable to retrieve number of handles.",
+		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	else
+	if( number_of_handles > 0 )
 	{
-		if( libbfio_handle_get_size(
-		     handle,
-		     size,
-		     error ) != 1 )
+		check_values_size = sizeof( libbfio_internal_pool_check_value_t ) * number_of_handles;
+
+		if( check_values_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve size of entry: %d.",
-			 function,
-			 entry );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid check values size value exceeds maximum.",
+			 function );
 
-			result = -1;
+			goto on_error;
+		}
+		check_values = (libbfio_internal_pool_check_value_t *) memory_allocate(
+		                                                        check_values_size );
+
+		if( check_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create check values.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry = 0;
+		     entry < number_of_handles;
+		     entry++ )
+		{
+			check_values[ entry ].result = -1;
+
+			if( libcdata_array_get_entry_by_index(
+			     internal_pool->handles_array,
+			     entry,
+			     (intptr_t **) &( check_values[ entry ].handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve handle: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( number_of_threads > 0 )
+		{
+			if( libcthreads_thread_pool_create(
+			     &thread_pool,
+			     NULL,
+			     number_of_threads,
+			     number_of_handles,
+			     (int (*)(intptr_t *, void *)) &libbfio_internal_pool_check_handle,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+			for( entry = 0;
+			     entry < number_of_handles;
+			     entry++ )
+			{
+				if( libcthreads_thread_pool_push(
+				     thread_pool,
+				     (intptr_t *) &( check_values[ entry ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push handle: %d onto thread pool queue.",
+					 function,
+					 entry );
+
+					goto on_error;
+				}
+			}
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+#endif
+		{
+			for( entry = 0;
+			     entry < number_of_handles;
+			     entry++ )
+			{
+				libbfio_internal_pool_check_handle(
+				 &( check_values[ entry ] ),
+				 NULL );
+			}
+		}
+		for( entry = 0;
+		     entry < number_of_handles;
+		     entry++ )
+		{
+			if( check_values[ entry ].result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check handle: %d.",
+				 function,
+				 entry );
+
+				goto on_error;
+			}
+			else if( check_values[ entry ].result == 0 )
+			{
+				result = 0;
+			}
 		}
+		memory_free(
+		 check_values );
+
+		check_values = NULL;
 	}
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libbfio_lock_release_for_write(
 	     internal_pool->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3519,5 +8534,25 @@ int libbfio_pool_get_size(
 	}
 #endif
 	return( result );
-}
 
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( check_values != NULL )
+	{
+		memory_free(
+		 check_values );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libbfio_lock_release_for_write(
+	 internal_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
@@ -25,16 +25,58 @@
 #include <common.h>
 #include <types.h>
 
+#include "libbfio_arena.h"
 #include "libbfio_extern.h"
 #include "libbfio_libcdata.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libcthreads.h"
+#include "libbfio_lock.h"
+#include "libbfio_trace.h"
 #include "libbfio_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The minimum number of open handles of an adaptive maximum
+ */
+#define LIBBFIO_POOL_ADAPTIVE_MINIMUM_NUMBER_OF_OPEN_HANDLES		4
+
+/* The number of accesses after which an adaptive maximum number of open handles is adapted
+ */
+#define LIBBFIO_POOL_ADAPTIVE_NUMBER_OF_ACCESSES			256
+
+/* The adaptive maximum number of open handles is increased if more than
+ * 1 / LIBBFIO_POOL_ADAPTIVE_REOPEN_RATE_DIVISOR of the accesses required a reopen
+ */
+#define LIBBFIO_POOL_ADAPTIVE_REOPEN_RATE_DIVISOR			8
+
+typedef struct libbfio_internal_pool_check_value libbfio_internal_pool_check_value_t;
+
+struct libbfio_internal_pool_check_value
+{
+	/* The handle
+	 */
+	libbfio_handle_t *handle;
+
+	/* The result of the check
+	 */
+	int result;
+};
+
+typedef struct libbfio_internal_pool_close_value libbfio_internal_pool_close_value_t;
+
+struct libbfio_internal_pool_close_value
+{
+	/* The handle
+	 */
+	libbfio_handle_t *handle;
+
+	/* The result of the close
+	 */
+	int result;
+};
+
 typedef struct libbfio_internal_pool libbfio_internal_pool_t;
 
 struct libbfio_internal_pool
@@ -51,6 +93,29 @@ struct libbfio_internal_pool
 	 */
 	int maximum_number_of_open_handles;
 
+	/* The eviction policy that determines which handle is closed
+	 * when the maximum number of open handles is reached
+	 */
+	int eviction_policy;
+
+	/* The number of handles closed by the eviction policy
+	 */
+	uint64_t number_of_evictions;
+
+	/* Value to indicate the maximum number of open handles is adaptive
+	 */
+	uint8_t adaptive_maximum_number_of_open_handles;
+
+	/* The number of accesses of a handle other than the current handle
+	 * since the maximum number of open handles was last adapted
+	 */
+	int adaptive_number_of_accesses;
+
+	/* The number of accesses that required a handle to be reopened
+	 * since the maximum number of open handles was last adapted
+	 */
+	int adaptive_number_of_reopens;
+
 	/* The handles array
 	 */
 	libcdata_array_t *handles_array;
@@ -69,10 +134,82 @@ struct libbfio_internal_pool
 	 */
 	libcdata_list_t *last_used_list;
 
+	/* The arena from which the handles created by the pool are allocated
+	 */
+	libbfio_arena_t *arena;
+
+	/* The descriptor manager that limits the number of open handles
+	 * this value is not managed by the pool
+	 */
+	libbfio_descriptor_manager_t *descriptor_manager;
+
+	/* The additional flags of the handles created by the pool
+	 */
+	uint8_t handle_flags;
+
+	/* Value to indicate the next entry should be opened in advance
+	 * when the entries are accessed sequentially
+	 */
+	uint8_t pre_open_next_entry;
+
+	/* The size of the data to prefetch at the start of a pre-opened entry
+	 */
+	size64_t pre_open_prefetch_size;
+
+	/* The error mode
+	 */
+	int error_mode;
+
+	/* The error domain of the last failed read or open
+	 */
+	int last_error_domain;
+
+	/* The error code of the last failed read or open
+	 */
+	int last_error_code;
+
+	/* The trace callbacks
+	 */
+	libbfio_trace_t trace;
+
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
-	/* The read/write lock
+	/* The read/write lock, which references the embedded lock or is NULL
 	 */
-	libcthreads_read_write_lock_t *read_write_lock;
+	libbfio_lock_t *read_write_lock;
+
+	/* The embedded lock
+	 */
+	libbfio_lock_t embedded_lock;
+
+	/* The thread pool with a single thread that opens the next entry in advance,
+	 * it is created on the first pre-open and joined when the pool is freed
+	 */
+	libcthreads_thread_pool_t *pre_open_thread_pool;
+
+	/* The mutex and condition used to signal a pre-open has completed
+	 */
+	libcthreads_mutex_t *pre_open_mutex;
+	libcthreads_condition_t *pre_open_condition;
+
+	/* Value to indicate a pre-open has been queued and not yet completed
+	 */
+	uint8_t pre_open_is_pending;
+
+	/* The handle that is being opened by the pre-open thread
+	 */
+	libbfio_handle_t *pre_open_handle;
+
+	/* The access flags of the handle that is being opened by the pre-open thread
+	 */
+	int pre_open_access_flags;
+
+	/* The size of the data to prefetch of the handle that is being opened by the pre-open thread
+	 */
+	size64_t pre_open_handle_prefetch_size;
+
+	/* The result of the pre-open
+	 */
+	int pre_open_result;
 #endif
 };
 
@@ -83,11 +220,24 @@ int libbfio_pool_initialize(
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_initialize_with_arena(
+     libbfio_pool_t **pool,
+     int number_of_handles,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_free(
      libbfio_pool_t **pool,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_free_parallel(
+     libbfio_pool_t **pool,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_clone(
      libbfio_pool_t **destination_pool,
@@ -102,15 +252,31 @@ int libbfio_pool_resize(
 
 int libbfio_internal_pool_open_handle(
      libbfio_internal_pool_t *internal_pool,
+     int entry,
      libbfio_handle_t *handle,
      int access_flags,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_set_handle_descriptor_manager(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
 int libbfio_internal_pool_append_handle_to_last_used_list(
      libbfio_internal_pool_t *internal_pool,
      const libbfio_handle_t *handle,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_get_eviction_list_element(
+     libbfio_internal_pool_t *internal_pool,
+     libcdata_list_element_t **list_element,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_close_evicted_handle(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
 int libbfio_internal_pool_move_handle_to_front_of_last_used_list(
      libbfio_internal_pool_t *internal_pool,
      libbfio_handle_t *handle,
@@ -142,6 +308,15 @@ int libbfio_pool_append_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_append_handles(
+     libbfio_pool_t *pool,
+     int *first_entry,
+     libbfio_handle_t * const handles[],
+     int number_of_handles,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_set_handle(
      libbfio_pool_t *pool,
@@ -163,12 +338,130 @@ int libbfio_pool_get_maximum_number_of_open_handles(
      int *maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_set_maximum_number_of_open_handles(
+     libbfio_internal_pool_t *internal_pool,
+     int maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_set_maximum_number_of_open_handles(
      libbfio_pool_t *pool,
      int maximum_number_of_open_handles,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_set_adaptive_maximum_number_of_open_handles(
+     libbfio_pool_t *pool,
+     uint8_t adaptive_maximum_number_of_open_handles,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_adapt_maximum_number_of_open_handles(
+     libbfio_internal_pool_t *internal_pool,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_decrease_maximum_number_of_open_handles(
+     libbfio_internal_pool_t *internal_pool,
+     libbfio_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_eviction_policy(
+     libbfio_pool_t *pool,
+     int *eviction_policy,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_eviction_policy(
+     libbfio_pool_t *pool,
+     int eviction_policy,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_handle_pinned(
+     libbfio_pool_t *pool,
+     int entry,
+     uint8_t pinned,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_descriptor_manager(
+     libbfio_pool_t *pool,
+     libbfio_descriptor_manager_t *descriptor_manager,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_single_threaded_handles(
+     libbfio_pool_t *pool,
+     uint8_t single_threaded_handles,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_pre_open_next_entry(
+     libbfio_pool_t *pool,
+     uint8_t pre_open_next_entry,
+     size64_t prefetch_size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_error_mode(
+     libbfio_pool_t *pool,
+     int *error_mode,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_error_mode(
+     libbfio_pool_t *pool,
+     int error_mode,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_last_error(
+     libbfio_pool_t *pool,
+     int *error_domain,
+     int *error_code,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_track_lock_statistics(
+     libbfio_pool_t *pool,
+     uint8_t track_lock_statistics,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_get_lock_statistics(
+     libbfio_pool_t *pool,
+     uint64_t *number_of_grabs,
+     uint64_t *number_of_contended_grabs,
+     uint64_t *total_wait_time,
+     uint64_t *maximum_wait_time,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_trace_callbacks(
+     libbfio_pool_t *pool,
+     void (*pre_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size ),
+     void (*post_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size,
+            int64_t result,
+            uint64_t duration ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_trace_recorder(
+     libbfio_pool_t *pool,
+     libbfio_trace_recorder_t *trace_recorder,
+     libcerror_error_t **error );
+
 int libbfio_internal_pool_open(
      libbfio_internal_pool_t *internal_pool,
      int entry,
@@ -200,11 +493,54 @@ int libbfio_pool_close(
      int entry,
      libcerror_error_t **error );
 
+int libbfio_internal_pool_close_all(
+     libbfio_internal_pool_t *internal_pool,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_close_handle(
+     libbfio_internal_pool_close_value_t *close_value,
+     void *arguments );
+
+int libbfio_internal_pool_free_handle(
+     libbfio_internal_pool_close_value_t *close_value,
+     void *arguments );
+
+int libbfio_internal_pool_process_close_values(
+     libbfio_internal_pool_close_value_t *close_values,
+     int number_of_close_values,
+     int number_of_threads,
+     int (*callback_function)(
+            libbfio_internal_pool_close_value_t *close_value,
+            void *arguments ),
+     libcerror_error_t **error );
+
 LIBBFIO_EXTERN \
 int libbfio_pool_close_all(
      libbfio_pool_t *pool,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_close_all_parallel(
+     libbfio_pool_t *pool,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+int libbfio_internal_pool_pre_open_callback_function(
+     libbfio_handle_t *handle,
+     libbfio_internal_pool_t *internal_pool );
+
+int libbfio_internal_pool_pre_open_handle(
+     libbfio_internal_pool_t *internal_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_wait_for_pre_open(
+     libbfio_internal_pool_t *internal_pool,
+     libcerror_error_t **error );
+
+#endif
 int libbfio_internal_pool_get_open_handle(
      libbfio_internal_pool_t *internal_pool,
      int entry,
@@ -267,6 +603,32 @@ int libbfio_pool_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_pool_prefetch(
+     libbfio_pool_t *pool,
+     int entry,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_set_access_hint(
+     libbfio_pool_t *pool,
+     int access_hint,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libbfio_internal_pool_check_handle(
+     libbfio_internal_pool_check_value_t *check_value,
+     void *arguments );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_check_handles(
+     libbfio_pool_t *pool,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,58 @@
+/*
+ * Pool span functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_POOL_SPAN_H )
+#define _LIBBFIO_POOL_SPAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBBFIO_EXTERN \
+int libbfio_pool_span_initialize(
+     libbfio_handle_t **handle,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_span_get_pool(
+     libbfio_handle_t *handle,
+     libbfio_pool_t **pool,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_pool_span_set_pool(
+     libbfio_handle_t *handle,
+     libbfio_pool_t *pool,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_POOL_SPAN_H ) */
+
@@ -0,0 +1,1095 @@
+/*
+ * Pool span IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libbfio_definitions.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_pool.h"
+#include "libbfio_pool_span_io_handle.h"
+#include "libbfio_types.h"
+
+/* Creates a pool span IO handle
+ * Make sure the value pool_span_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_initialize(
+     libbfio_pool_span_io_handle_t **pool_span_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_initialize";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool_span_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool span IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*pool_span_io_handle = memory_allocate_structure(
+	                        libbfio_pool_span_io_handle_t );
+
+	if( *pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pool span IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *pool_span_io_handle,
+	     0,
+	     sizeof( libbfio_pool_span_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pool span IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *pool_span_io_handle != NULL )
+	{
+		memory_free(
+		 *pool_span_io_handle );
+
+		*pool_span_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a pool span IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_free(
+     libbfio_pool_span_io_handle_t **pool_span_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_free";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pool_span_io_handle != NULL )
+	{
+		/* The pool is not managed by the pool span IO handle
+		 */
+		if( ( *pool_span_io_handle )->segment_offsets != NULL )
+		{
+			memory_free(
+			 ( *pool_span_io_handle )->segment_offsets );
+		}
+		memory_free(
+		 *pool_span_io_handle );
+
+		*pool_span_io_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones (duplicates) the pool span IO handle and its attributes
+ * The clone references the same pool and needs to be opened
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_clone(
+     libbfio_pool_span_io_handle_t **destination_pool_span_io_handle,
+     libbfio_pool_span_io_handle_t *source_pool_span_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_clone";
+
+	if( destination_pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_pool_span_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination pool span IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_pool_span_io_handle == NULL )
+	{
+		*destination_pool_span_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_pool_span_io_handle_initialize(
+	     destination_pool_span_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing destination pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	( *destination_pool_span_io_handle )->pool         = source_pool_span_io_handle->pool;
+	( *destination_pool_span_io_handle )->access_flags = source_pool_span_io_handle->access_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the pool of the pool span IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_get_pool(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libbfio_pool_t **pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_get_pool";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	*pool = pool_span_io_handle->pool;
+
+	return( 1 );
+}
+
+/* Sets the pool of the pool span IO handle
+ * The pool is not managed by the pool span IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_set_pool(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libbfio_pool_t *pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_set_pool";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool span IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	pool_span_io_handle->pool = pool;
+
+	return( 1 );
+}
+
+/* Retrieves the segment that contains a specific offset
+ * The segment offsets are searched using a binary search, the segment
+ * of the most recent access is tried first to speed up sequential access
+ * Returns 1 if successful, 0 if the offset is beyond the end of the span or -1 on error
+ */
+int libbfio_pool_span_io_handle_get_segment_at_offset(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libbfio_pool_span_io_handle_get_segment_at_offset";
+	int lower_segment_index    = 0;
+	int middle_segment_index   = 0;
+	int upper_segment_index    = 0;
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - missing segment offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset >= pool_span_io_handle->segment_offsets[ pool_span_io_handle->number_of_segments ] )
+	{
+		return( 0 );
+	}
+	middle_segment_index = pool_span_io_handle->current_segment_index;
+
+	if( ( middle_segment_index < 0 )
+	 || ( middle_segment_index >= pool_span_io_handle->number_of_segments )
+	 || ( offset < pool_span_io_handle->segment_offsets[ middle_segment_index ] )
+	 || ( offset >= pool_span_io_handle->segment_offsets[ middle_segment_index + 1 ] ) )
+	{
+		/* Find the last segment that starts at or before the offset,
+		 * this skips segments of size 0
+		 */
+		lower_segment_index = 0;
+		upper_segment_index = pool_span_io_handle->number_of_segments - 1;
+
+		while( lower_segment_index < upper_segment_index )
+		{
+			middle_segment_index = upper_segment_index - ( ( upper_segment_index - lower_segment_index ) / 2 );
+
+			if( offset < pool_span_io_handle->segment_offsets[ middle_segment_index ] )
+			{
+				upper_segment_index = middle_segment_index - 1;
+			}
+			else
+			{
+				lower_segment_index = middle_segment_index;
+			}
+		}
+		middle_segment_index = lower_segment_index;
+
+		pool_span_io_handle->current_segment_index = middle_segment_index;
+	}
+	*segment_index  = middle_segment_index;
+	*segment_offset = offset - pool_span_io_handle->segment_offsets[ middle_segment_index ];
+
+	return( 1 );
+}
+
+/* Opens the pool span IO handle
+ * This determines the size of every segment in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_open(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function  = "libbfio_pool_span_io_handle_open";
+	size64_t segment_size  = 0;
+	int number_of_segments = 0;
+	int segment_index      = 0;
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - missing pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pool span IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	/* Either read or write flag should be set
+	 */
+	if( ( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	/* The span cannot be truncated
+	 */
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_TRUNCATE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x.",
+		 function,
+		 access_flags );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     pool_span_io_handle->pool,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_segments < 0 )
+	 || ( (size_t) number_of_segments > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of segments value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	pool_span_io_handle->segment_offsets = (off64_t *) memory_allocate(
+	                                                    sizeof( off64_t ) * ( number_of_segments + 1 ) );
+
+	if( pool_span_io_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment offsets.",
+		 function );
+
+		goto on_error;
+	}
+	pool_span_io_handle->segment_offsets[ 0 ] = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( libbfio_pool_get_size(
+		     pool_span_io_handle->pool,
+		     segment_index,
+		     &segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( segment_size > (size64_t) ( INT64_MAX - pool_span_io_handle->segment_offsets[ segment_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment: %d size value out of bounds.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		pool_span_io_handle->segment_offsets[ segment_index + 1 ] = pool_span_io_handle->segment_offsets[ segment_index ]
+		                                                          + (off64_t) segment_size;
+	}
+	pool_span_io_handle->number_of_segments    = number_of_segments;
+	pool_span_io_handle->current_segment_index = 0;
+	pool_span_io_handle->current_offset        = 0;
+	pool_span_io_handle->access_flags          = access_flags;
+	pool_span_io_handle->is_open               = 1;
+
+	return( 1 );
+
+on_error:
+	if( pool_span_io_handle->segment_offsets != NULL )
+	{
+		memory_free(
+		 pool_span_io_handle->segment_offsets );
+
+		pool_span_io_handle->segment_offsets = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the pool span IO handle
+ * The handles in the pool are not closed
+ * Returns 0 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_close(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_close";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->segment_offsets != NULL )
+	{
+		memory_free(
+		 pool_span_io_handle->segment_offsets );
+
+		pool_span_io_handle->segment_offsets = NULL;
+	}
+	pool_span_io_handle->number_of_segments = 0;
+	pool_span_io_handle->is_open            = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the pool span IO handle
+ * Reads that cross a segment boundary are split over the segments
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libbfio_pool_span_io_handle_read_buffer(
+         libbfio_pool_span_io_handle_t *pool_span_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function  = "libbfio_pool_span_io_handle_read_buffer";
+	off64_t segment_offset = 0;
+	size_t buffer_offset   = 0;
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+	int result             = 0;
+	int segment_index      = 0;
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pool_span_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - no read access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		result = libbfio_pool_span_io_handle_get_segment_at_offset(
+		          pool_span_io_handle,
+		          pool_span_io_handle->current_offset,
+		          &segment_index,
+		          &segment_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 pool_span_io_handle->current_offset,
+			 pool_span_io_handle->current_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		read_size = size - buffer_offset;
+
+		if( (size64_t) read_size > (size64_t) ( pool_span_io_handle->segment_offsets[ segment_index + 1 ] - pool_span_io_handle->current_offset ) )
+		{
+			read_size = (size_t) ( pool_span_io_handle->segment_offsets[ segment_index + 1 ] - pool_span_io_handle->current_offset );
+		}
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool_span_io_handle->pool,
+		              segment_index,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              segment_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from segment: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 segment_index,
+			 segment_offset,
+			 segment_offset );
+
+			return( -1 );
+		}
+		buffer_offset                       += (size_t) read_count;
+		pool_span_io_handle->current_offset += (off64_t) read_count;
+
+		/* The segment is smaller than when the span was opened
+		 */
+		if( (size_t) read_count != read_size )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the pool span IO handle
+ * Writes that cross a segment boundary are split over the segments,
+ * the size of the span cannot be extended
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libbfio_pool_span_io_handle_write_buffer(
+         libbfio_pool_span_io_handle_t *pool_span_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function  = "libbfio_pool_span_io_handle_write_buffer";
+	off64_t segment_offset = 0;
+	size_t buffer_offset   = 0;
+	size_t write_size      = 0;
+	ssize_t write_count    = 0;
+	int result             = 0;
+	int segment_index      = 0;
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pool_span_io_handle->access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - no write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		result = libbfio_pool_span_io_handle_get_segment_at_offset(
+		          pool_span_io_handle,
+		          pool_span_io_handle->current_offset,
+		          &segment_index,
+		          &segment_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 pool_span_io_handle->current_offset,
+			 pool_span_io_handle->current_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		write_size = size - buffer_offset;
+
+		if( (size64_t) write_size > (size64_t) ( pool_span_io_handle->segment_offsets[ segment_index + 1 ] - pool_span_io_handle->current_offset ) )
+		{
+			write_size = (size_t) ( pool_span_io_handle->segment_offsets[ segment_index + 1 ] - pool_span_io_handle->current_offset );
+		}
+		write_count = libbfio_pool_write_buffer_at_offset(
+		               pool_span_io_handle->pool,
+		               segment_index,
+		               &( buffer[ buffer_offset ] ),
+		               write_size,
+		               segment_offset,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to segment: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 segment_index,
+			 segment_offset,
+			 segment_offset );
+
+			return( -1 );
+		}
+		buffer_offset                       += (size_t) write_count;
+		pool_span_io_handle->current_offset += (off64_t) write_count;
+
+		if( (size_t) write_count != write_size )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset within the pool span IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libbfio_pool_span_io_handle_seek_offset(
+         libbfio_pool_span_io_handle_t *pool_span_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_seek_offset";
+	off64_t base_offset   = 0;
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		base_offset = pool_span_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		base_offset = pool_span_io_handle->segment_offsets[ pool_span_io_handle->number_of_segments ];
+	}
+	if( ( offset > 0 )
+	 && ( base_offset > ( INT64_MAX - offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	offset += base_offset;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	pool_span_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a pool span exists
+ * Returns 1 if the pool span exists, 0 if not or -1 on error
+ */
+int libbfio_pool_span_io_handle_exists(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_exists";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->pool == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Check if the pool span is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libbfio_pool_span_io_handle_is_open(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_is_open";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the pool span size
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_pool_span_io_handle_get_size(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_pool_span_io_handle_get_size";
+
+	if( pool_span_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool span IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool_span_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pool span IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = (size64_t) pool_span_io_handle->segment_offsets[ pool_span_io_handle->number_of_segments ];
+
+	return( 1 );
+}
+
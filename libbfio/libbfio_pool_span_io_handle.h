@@ -0,0 +1,144 @@
+/*
+ * Pool span IO handle functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_POOL_SPAN_IO_HANDLE_H )
+#define _LIBBFIO_POOL_SPAN_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_pool_span_io_handle libbfio_pool_span_io_handle_t;
+
+struct libbfio_pool_span_io_handle
+{
+	/* The pool, which is not managed by the pool span IO handle
+	 */
+	libbfio_pool_t *pool;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The segment offsets, a prefix sum of the segment sizes
+	 * that contains number of segments + 1 values
+	 */
+	off64_t *segment_offsets;
+
+	/* The index of the segment of the most recent access
+	 */
+	int current_segment_index;
+
+	/* The current offset in the span
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the pool span is open
+	 */
+	uint8_t is_open;
+
+	/* The current access flags
+	 */
+	int access_flags;
+};
+
+int libbfio_pool_span_io_handle_initialize(
+     libbfio_pool_span_io_handle_t **pool_span_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_free(
+     libbfio_pool_span_io_handle_t **pool_span_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_clone(
+     libbfio_pool_span_io_handle_t **destination_pool_span_io_handle,
+     libbfio_pool_span_io_handle_t *source_pool_span_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_get_pool(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libbfio_pool_t **pool,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_set_pool(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libbfio_pool_t *pool,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_get_segment_at_offset(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     off64_t offset,
+     int *segment_index,
+     off64_t *segment_offset,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_open(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_close(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libbfio_pool_span_io_handle_read_buffer(
+         libbfio_pool_span_io_handle_t *pool_span_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libbfio_pool_span_io_handle_write_buffer(
+         libbfio_pool_span_io_handle_t *pool_span_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libbfio_pool_span_io_handle_seek_offset(
+         libbfio_pool_span_io_handle_t *pool_span_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_exists(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_is_open(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     libcerror_error_t **error );
+
+int libbfio_pool_span_io_handle_get_size(
+     libbfio_pool_span_io_handle_t *pool_span_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_POOL_SPAN_IO_HANDLE_H ) */
+
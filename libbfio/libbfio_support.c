@@ -25,6 +25,7 @@
 #include "libbfio_definitions.h"
 #include "libbfio_libcerror.h"
 #include "libbfio_libclocale.h"
+#include "libbfio_lock.h"
 #include "libbfio_support.h"
 
 #if !defined( HAVE_LOCAL_LIBBFIO )
@@ -89,5 +90,56 @@ int libbfio_set_codepage(
 	return( 1 );
 }
 
+/* Retrieves the lock type used by newly created handles and pools
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_get_lock_type(
+     int *lock_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_get_lock_type";
+
+	if( libbfio_lock_get_default_type(
+	     lock_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lock type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the lock type used by newly created handles and pools
+ * Existing handles and pools keep the lock type they were created with
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_set_lock_type(
+     int lock_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_set_lock_type";
+
+	if( libbfio_lock_set_default_type(
+	     lock_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set lock type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 #endif /* !defined( HAVE_LOCAL_LIBBFIO ) */
 
@@ -48,6 +48,16 @@ int libbfio_set_codepage(
      int codepage,
      libcerror_error_t **error );
 
+LIBBFIO_EXTERN \
+int libbfio_get_lock_type(
+     int *lock_type,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_set_lock_type(
+     int lock_type,
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBBFIO ) */
 
 #if defined( __cplusplus )
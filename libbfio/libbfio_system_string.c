@@ -35,6 +35,206 @@
 #error Unsupported size of wchar_t
 #endif
 
+/* Determines the length of a narrow string that only contains ASCII characters
+ * The string is checked in blocks of LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE characters
+ * without early exits so that the compiler can vectorize the check
+ * The length does not include the end-of-string character
+ * Returns 1 if successful, 0 if the string contains non-ASCII characters or -1 on error
+ */
+int libbfio_system_string_get_ascii_narrow_string_length(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     size_t *length,
+     libcerror_error_t **error )
+{
+	const uint8_t *string_data = NULL;
+	static char *function      = "libbfio_system_string_get_ascii_narrow_string_length";
+	size_t block_index         = 0;
+	size_t string_index        = 0;
+	uint8_t combined_value     = 0;
+	uint8_t end_of_string      = 0;
+
+	if( narrow_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid narrow string.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid narrow string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid length.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_size == 0 )
+	{
+		return( 0 );
+	}
+	string_data = (const uint8_t *) narrow_string;
+
+	while( ( narrow_string_size - string_index ) >= LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE )
+	{
+		combined_value = 0;
+		end_of_string  = 0;
+
+		for( block_index = 0;
+		     block_index < LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE;
+		     block_index++ )
+		{
+			combined_value |= string_data[ string_index + block_index ];
+			end_of_string  |= (uint8_t) ( string_data[ string_index + block_index ] == 0 );
+		}
+		if( ( ( combined_value & 0x80 ) != 0 )
+		 || ( end_of_string != 0 ) )
+		{
+			break;
+		}
+		string_index += LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE;
+	}
+	/* The remainder, or the block that contains the end-of-string
+	 * or a non-ASCII character, is checked per character
+	 */
+	while( string_index < narrow_string_size )
+	{
+		if( string_data[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( string_data[ string_index ] >= 0x80 )
+		{
+			return( 0 );
+		}
+		string_index++;
+	}
+	*length = string_index;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines the length of a wide string that only contains ASCII characters
+ * The string is checked in blocks of LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE characters
+ * without early exits so that the compiler can vectorize the check
+ * The length does not include the end-of-string character
+ * Returns 1 if successful, 0 if the string contains non-ASCII characters or -1 on error
+ */
+int libbfio_system_string_get_ascii_wide_string_length(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *length,
+     libcerror_error_t **error )
+{
+	static char *function   = "libbfio_system_string_get_ascii_wide_string_length";
+	size_t block_index      = 0;
+	size_t string_index     = 0;
+	uint32_t character      = 0;
+	uint32_t combined_value = 0;
+	uint8_t end_of_string   = 0;
+
+	if( wide_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid length.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_size == 0 )
+	{
+		return( 0 );
+	}
+	while( ( wide_string_size - string_index ) >= LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE )
+	{
+		combined_value = 0;
+		end_of_string  = 0;
+
+		for( block_index = 0;
+		     block_index < LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE;
+		     block_index++ )
+		{
+			character = (uint32_t) wide_string[ string_index + block_index ];
+
+			combined_value |= character;
+			end_of_string  |= (uint8_t) ( character == 0 );
+		}
+		if( ( combined_value >= 0x80 )
+		 || ( end_of_string != 0 ) )
+		{
+			break;
+		}
+		string_index += LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE;
+	}
+	/* The remainder, or the block that contains the end-of-string
+	 * or a non-ASCII character, is checked per character
+	 */
+	while( string_index < wide_string_size )
+	{
+		character = (uint32_t) wide_string[ string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( character >= 0x80 )
+		{
+			return( 0 );
+		}
+		string_index++;
+	}
+	*length = string_index;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Determines the size of a narrow string from a system string
  * Returns 1 if successful or -1 on error
  */
@@ -47,10 +247,37 @@ int libbfio_system_string_size_to_narrow_string(
 	static char *function = "libbfio_system_string_size_to_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          system_string,
+	          system_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( narrow_string_size != NULL ) )
+	{
+		*narrow_string_size = string_length + 1;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -150,10 +377,46 @@ int libbfio_system_string_copy_to_narrow_string(
 	static char *function = "libbfio_system_string_copy_to_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_index   = 0;
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          system_string,
+	          system_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( narrow_string != NULL )
+	      && ( narrow_string_size <= (size_t) SSIZE_MAX )
+	      && ( narrow_string_size > string_length ) )
+	{
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			narrow_string[ string_index ] = (char) system_string[ string_index ];
+		}
+		narrow_string[ string_length ] = 0;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -292,10 +555,37 @@ int libbfio_system_string_size_from_narrow_string(
 	static char *function = "libbfio_system_string_size_from_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          narrow_string,
+	          narrow_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( system_string_size != NULL ) )
+	{
+		*system_string_size = string_length + 1;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -395,10 +685,46 @@ int libbfio_system_string_copy_from_narrow_string(
 	static char *function = "libbfio_system_string_copy_from_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_index   = 0;
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          narrow_string,
+	          narrow_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( system_string != NULL )
+	      && ( system_string_size <= (size_t) SSIZE_MAX )
+	      && ( system_string_size > string_length ) )
+	{
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			system_string[ string_index ] = (system_character_t) narrow_string[ string_index ];
+		}
+		system_string[ string_length ] = 0;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -539,6 +865,7 @@ int libbfio_system_string_size_to_wide_string(
 	static char *function = "libbfio_system_string_size_to_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
@@ -578,6 +905,32 @@ int libbfio_system_string_size_to_wide_string(
 	}
 	*wide_string_size = system_string_size;
 #else
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          system_string,
+	          system_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( wide_string_size != NULL ) )
+	{
+		*wide_string_size = string_length + 1;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -641,6 +994,8 @@ int libbfio_system_string_copy_to_wide_string(
 	static char *function = "libbfio_system_string_copy_to_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_index   = 0;
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
@@ -716,6 +1071,40 @@ int libbfio_system_string_copy_to_wide_string(
 	}
 	wide_string[ system_string_size - 1 ] = 0;
 #else
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          system_string,
+	          system_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( wide_string != NULL )
+	      && ( wide_string_size <= (size_t) SSIZE_MAX )
+	      && ( wide_string_size > string_length ) )
+	{
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			wide_string[ string_index ] = (wchar_t) system_string[ string_index ];
+		}
+		wide_string[ string_length ] = 0;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -782,6 +1171,7 @@ int libbfio_system_string_size_from_wide_string(
 	static char *function = "libbfio_system_string_size_from_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
@@ -821,6 +1211,32 @@ int libbfio_system_string_size_from_wide_string(
 	}
 	*system_string_size = wide_string_size;
 #else
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          wide_string,
+	          wide_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( system_string_size != NULL ) )
+	{
+		*system_string_size = string_length + 1;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
@@ -884,6 +1300,8 @@ int libbfio_system_string_copy_from_wide_string(
 	static char *function = "libbfio_system_string_copy_from_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t string_index   = 0;
+	size_t string_length  = 0;
 	int result            = 0;
 #endif
 
@@ -959,6 +1377,40 @@ int libbfio_system_string_copy_from_wide_string(
 	}
 	system_string[ wide_string_size - 1 ] = 0;
 #else
+	/* ASCII characters are the same in UTF-8 and all supported codepages
+	 */
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          wide_string,
+	          wide_string_size,
+	          &string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII string length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( system_string != NULL )
+	      && ( system_string_size <= (size_t) SSIZE_MAX )
+	      && ( system_string_size > string_length ) )
+	{
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			system_string[ string_index ] = (system_character_t) wide_string[ string_index ];
+		}
+		system_string[ string_length ] = 0;
+
+		return( 1 );
+	}
 	if( libclocale_codepage == 0 )
 	{
 #if SIZEOF_WCHAR_T == 4
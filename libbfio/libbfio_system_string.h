@@ -31,6 +31,26 @@
 extern "C" {
 #endif
 
+/* The number of characters that are checked at a time by the ASCII fast path
+ */
+#define LIBBFIO_SYSTEM_STRING_ASCII_BLOCK_SIZE	16
+
+int libbfio_system_string_get_ascii_narrow_string_length(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     size_t *length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libbfio_system_string_get_ascii_wide_string_length(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 int libbfio_system_string_size_to_narrow_string(
      const system_character_t *system_string,
      size_t system_string_size,
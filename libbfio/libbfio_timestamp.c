@@ -0,0 +1,103 @@
+/*
+ * Timestamp functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libbfio_timestamp.h"
+
+/* Retrieves a monotonic timestamp in nano seconds
+ * Returns the timestamp or 0 if not available
+ */
+uint64_t libbfio_timestamp_get_monotonic(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart == 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( CLOCK_MONOTONIC )
+	struct timespec timestamp;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &timestamp ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) timestamp.tv_sec * 1000000000UL ) + (uint64_t) timestamp.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif /* defined( WINAPI ) */
+}
+
+/* Waits until the monotonic timestamp in nano seconds has been reached
+ */
+void libbfio_timestamp_wait_until(
+      uint64_t timestamp )
+{
+#if !defined( WINAPI ) && defined( CLOCK_MONOTONIC )
+	struct timespec wait_time;
+#endif
+
+	uint64_t current_timestamp = 0;
+	uint64_t time_to_wait      = 0;
+
+	current_timestamp = libbfio_timestamp_get_monotonic();
+
+	if( ( current_timestamp == 0 )
+	 || ( current_timestamp >= timestamp ) )
+	{
+		return;
+	}
+	time_to_wait = timestamp - current_timestamp;
+
+#if defined( WINAPI )
+	Sleep(
+	 (DWORD) ( time_to_wait / 1000000 ) );
+
+#elif defined( CLOCK_MONOTONIC )
+	wait_time.tv_sec  = (time_t) ( time_to_wait / 1000000000UL );
+	wait_time.tv_nsec = (long) ( time_to_wait % 1000000000UL );
+
+	nanosleep(
+	 &wait_time,
+	 NULL );
+
+#endif /* defined( WINAPI ) */
+}
+
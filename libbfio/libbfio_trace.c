@@ -0,0 +1,143 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+#include "libbfio_timestamp.h"
+#include "libbfio_trace.h"
+
+/* Sets the trace callbacks
+ * Tracing is enabled if at least one of the callbacks is set
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_trace_set_callbacks(
+     libbfio_trace_t *trace,
+     void (*pre_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size ),
+     void (*post_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size,
+            int64_t result,
+            uint64_t duration ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_trace_set_callbacks";
+
+	if( trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace.",
+		 function );
+
+		return( -1 );
+	}
+	trace->pre_callback  = pre_callback;
+	trace->post_callback = post_callback;
+	trace->callback_data = callback_data;
+
+	if( ( pre_callback != NULL )
+	 || ( post_callback != NULL ) )
+	{
+		trace->is_enabled = 1;
+	}
+	else
+	{
+		trace->is_enabled = 0;
+	}
+	return( 1 );
+}
+
+/* Calls the pre callback before an operation
+ * Returns the start timestamp of the operation
+ */
+uint64_t libbfio_trace_begin(
+          libbfio_trace_t *trace,
+          int operation,
+          int entry,
+          off64_t offset,
+          size64_t size )
+{
+	if( trace->pre_callback != NULL )
+	{
+		trace->pre_callback(
+		 trace->callback_data,
+		 operation,
+		 entry,
+		 offset,
+		 size );
+	}
+	if( trace->post_callback == NULL )
+	{
+		return( 0 );
+	}
+	return( libbfio_timestamp_get_monotonic() );
+}
+
+/* Calls the post callback after an operation
+ */
+void libbfio_trace_end(
+      libbfio_trace_t *trace,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size,
+      int64_t result,
+      uint64_t start_timestamp )
+{
+	uint64_t duration = 0;
+
+	if( trace->post_callback == NULL )
+	{
+		return;
+	}
+	duration = libbfio_timestamp_get_monotonic();
+
+	if( duration > start_timestamp )
+	{
+		duration -= start_timestamp;
+	}
+	else
+	{
+		duration = 0;
+	}
+	trace->post_callback(
+	 trace->callback_data,
+	 operation,
+	 entry,
+	 offset,
+	 size,
+	 result,
+	 duration );
+}
+
@@ -0,0 +1,107 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_TRACE_H )
+#define _LIBBFIO_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_trace libbfio_trace_t;
+
+struct libbfio_trace
+{
+	/* Value to indicate if tracing is enabled
+	 */
+	uint8_t is_enabled;
+
+	/* The callback that is called before an operation
+	 */
+	void (*pre_callback)(
+	       intptr_t *callback_data,
+	       int operation,
+	       int entry,
+	       off64_t offset,
+	       size64_t size );
+
+	/* The callback that is called after an operation
+	 */
+	void (*post_callback)(
+	       intptr_t *callback_data,
+	       int operation,
+	       int entry,
+	       off64_t offset,
+	       size64_t size,
+	       int64_t result,
+	       uint64_t duration );
+
+	/* The callback data
+	 */
+	intptr_t *callback_data;
+};
+
+int libbfio_trace_set_callbacks(
+     libbfio_trace_t *trace,
+     void (*pre_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size ),
+     void (*post_callback)(
+            intptr_t *callback_data,
+            int operation,
+            int entry,
+            off64_t offset,
+            size64_t size,
+            int64_t result,
+            uint64_t duration ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+uint64_t libbfio_trace_begin(
+          libbfio_trace_t *trace,
+          int operation,
+          int entry,
+          off64_t offset,
+          size64_t size );
+
+void libbfio_trace_end(
+      libbfio_trace_t *trace,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size,
+      int64_t result,
+      uint64_t start_timestamp );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_TRACE_H ) */
+
@@ -0,0 +1,103 @@
+/*
+ * The trace file definitions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBBFIO_TRACE_FILE_H )
+#define _LIBBFIO_TRACE_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct bfio_trace_file_header bfio_trace_file_header_t;
+
+struct bfio_trace_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "bfiotrc\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The record size
+	 * Consists of 4 bytes
+	 */
+	uint8_t record_size[ 4 ];
+};
+
+typedef struct bfio_trace_file_record bfio_trace_file_record_t;
+
+struct bfio_trace_file_record
+{
+	/* The start time relative to the start of the recording in nano seconds
+	 * Consists of 8 bytes
+	 */
+	uint8_t start_time[ 8 ];
+
+	/* The duration in nano seconds
+	 * Consists of 8 bytes
+	 */
+	uint8_t duration[ 8 ];
+
+	/* The offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t offset[ 8 ];
+
+	/* The size
+	 * Consists of 8 bytes
+	 */
+	uint8_t size[ 8 ];
+
+	/* The result
+	 * Consists of 8 bytes
+	 */
+	uint8_t result[ 8 ];
+
+	/* The entry
+	 * Consists of 4 bytes
+	 */
+	uint8_t entry[ 4 ];
+
+	/* The operation
+	 * Consists of 1 byte
+	 */
+	uint8_t operation;
+
+	/* Padding
+	 * Consists of 3 bytes
+	 */
+	uint8_t padding[ 3 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_TRACE_FILE_H ) */
+
@@ -0,0 +1,562 @@
+/*
+ * Trace recorder functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_trace_file.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_timestamp.h"
+#include "libbfio_trace_recorder.h"
+#include "libbfio_types.h"
+
+const uint8_t bfio_trace_file_signature[ 8 ] = { 'b', 'f', 'i', 'o', 't', 'r', 'c', 0x00 };
+
+/* Creates a trace recorder
+ * The trace recorder writes the operations it is passed by the trace callbacks
+ * of a handle or pool to the output handle, which must be open for writing
+ * and must not be the handle or part of the pool that is traced
+ * Make sure the value trace_recorder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_trace_recorder_initialize(
+     libbfio_trace_recorder_t **trace_recorder,
+     libbfio_handle_t *output_handle,
+     libcerror_error_t **error )
+{
+	bfio_trace_file_header_t file_header;
+
+	libbfio_internal_trace_recorder_t *internal_trace_recorder = NULL;
+	static char *function                                      = "libbfio_trace_recorder_initialize";
+	ssize_t write_count                                        = 0;
+
+	if( trace_recorder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace recorder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace_recorder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace recorder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_trace_recorder = memory_allocate_structure(
+	                           libbfio_internal_trace_recorder_t );
+
+	if( internal_trace_recorder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create trace recorder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_trace_recorder,
+	     0,
+	     sizeof( libbfio_internal_trace_recorder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trace recorder.",
+		 function );
+
+		memory_free(
+		 internal_trace_recorder );
+
+		return( -1 );
+	}
+	internal_trace_recorder->buffer_size = sizeof( bfio_trace_file_record_t ) * LIBBFIO_TRACE_RECORDER_NUMBER_OF_BUFFERED_RECORDS;
+
+	internal_trace_recorder->buffer = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * internal_trace_recorder->buffer_size );
+
+	if( internal_trace_recorder->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_initialize(
+	     &( internal_trace_recorder->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( memory_copy(
+	     file_header.signature,
+	     bfio_trace_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 LIBBFIO_TRACE_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.record_size,
+	 (uint32_t) sizeof( bfio_trace_file_record_t ) );
+
+	write_count = libbfio_handle_write_buffer(
+	               output_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( bfio_trace_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( bfio_trace_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_trace_recorder->output_handle   = output_handle;
+	internal_trace_recorder->start_timestamp = libbfio_timestamp_get_monotonic();
+
+	*trace_recorder = (libbfio_trace_recorder_t *) internal_trace_recorder;
+
+	return( 1 );
+
+on_error:
+	if( internal_trace_recorder != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( internal_trace_recorder->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_trace_recorder->mutex ),
+			 NULL );
+		}
+#endif
+		if( internal_trace_recorder->buffer != NULL )
+		{
+			memory_free(
+			 internal_trace_recorder->buffer );
+		}
+		memory_free(
+		 internal_trace_recorder );
+	}
+	return( -1 );
+}
+
+/* Frees a trace recorder
+ * The buffered records are written to the output handle, the trace recorder
+ * must be removed from the handles and pools that use it first
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_trace_recorder_free(
+     libbfio_trace_recorder_t **trace_recorder,
+     libcerror_error_t **error )
+{
+	libbfio_internal_trace_recorder_t *internal_trace_recorder = NULL;
+	static char *function                                      = "libbfio_trace_recorder_free";
+	int result                                                 = 1;
+
+	if( trace_recorder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace recorder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace_recorder != NULL )
+	{
+		internal_trace_recorder = (libbfio_internal_trace_recorder_t *) *trace_recorder;
+		*trace_recorder         = NULL;
+
+		if( libbfio_internal_trace_recorder_flush(
+		     internal_trace_recorder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush trace recorder.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+		if( libcthreads_mutex_free(
+		     &( internal_trace_recorder->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_trace_recorder->buffer );
+
+		memory_free(
+		 internal_trace_recorder );
+	}
+	return( result );
+}
+
+/* Writes the buffered records to the output handle
+ * This function is not multi-thread safe acquire the mutex before call
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_trace_recorder_flush(
+     libbfio_internal_trace_recorder_t *internal_trace_recorder,
+     libcerror_error_t **error )
+{
+	static char *function = "libbfio_internal_trace_recorder_flush";
+	ssize_t write_count   = 0;
+
+	if( internal_trace_recorder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace recorder.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_trace_recorder->buffer_offset > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               internal_trace_recorder->output_handle,
+		               internal_trace_recorder->buffer,
+		               internal_trace_recorder->buffer_offset,
+		               error );
+
+		internal_trace_recorder->buffer_offset = 0;
+
+		if( write_count < 0 )
+		{
+			internal_trace_recorder->write_failed = 1;
+		}
+	}
+	if( internal_trace_recorder->write_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the buffered records to the output handle
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_trace_recorder_flush(
+     libbfio_trace_recorder_t *trace_recorder,
+     libcerror_error_t **error )
+{
+	libbfio_internal_trace_recorder_t *internal_trace_recorder = NULL;
+	static char *function                                      = "libbfio_trace_recorder_flush";
+	int result                                                 = 1;
+
+	if( trace_recorder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace recorder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_trace_recorder = (libbfio_internal_trace_recorder_t *) trace_recorder;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_trace_recorder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_internal_trace_recorder_flush(
+	     internal_trace_recorder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush trace recorder.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_trace_recorder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_trace_recorder_get_number_of_records(
+     libbfio_trace_recorder_t *trace_recorder,
+     uint64_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libbfio_internal_trace_recorder_t *internal_trace_recorder = NULL;
+	static char *function                                      = "libbfio_trace_recorder_get_number_of_records";
+
+	if( trace_recorder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace recorder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_trace_recorder = (libbfio_internal_trace_recorder_t *) trace_recorder;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_trace_recorder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_records = internal_trace_recorder->number_of_records;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_release(
+	     internal_trace_recorder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Records an operation
+ * Callback function for the trace post callback of a handle or pool
+ * A failure to write the records is returned by the next flush
+ */
+void libbfio_trace_recorder_post_callback(
+      intptr_t *callback_data,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size,
+      int64_t result,
+      uint64_t duration )
+{
+	libbfio_internal_trace_recorder_t *internal_trace_recorder = NULL;
+	bfio_trace_file_record_t *record                           = NULL;
+	uint64_t current_timestamp                                 = 0;
+	uint64_t start_time                                        = 0;
+
+	if( callback_data == NULL )
+	{
+		return;
+	}
+	internal_trace_recorder = (libbfio_internal_trace_recorder_t *) callback_data;
+
+	current_timestamp = libbfio_timestamp_get_monotonic();
+
+	if( current_timestamp >= ( internal_trace_recorder->start_timestamp + duration ) )
+	{
+		start_time = current_timestamp - internal_trace_recorder->start_timestamp - duration;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( libcthreads_mutex_grab(
+	     internal_trace_recorder->mutex,
+	     NULL ) != 1 )
+	{
+		internal_trace_recorder->write_failed = 1;
+
+		return;
+	}
+#endif
+	if( ( internal_trace_recorder->buffer_offset + sizeof( bfio_trace_file_record_t ) ) > internal_trace_recorder->buffer_size )
+	{
+		libbfio_internal_trace_recorder_flush(
+		 internal_trace_recorder,
+		 NULL );
+	}
+	record = (bfio_trace_file_record_t *) &( internal_trace_recorder->buffer[ internal_trace_recorder->buffer_offset ] );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 record->start_time,
+	 start_time );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 record->duration,
+	 duration );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 record->offset,
+	 (uint64_t) offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 record->size,
+	 size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 record->result,
+	 (uint64_t) result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 record->entry,
+	 (uint32_t) entry );
+
+	record->operation    = (uint8_t) operation;
+	record->padding[ 0 ] = 0;
+	record->padding[ 1 ] = 0;
+	record->padding[ 2 ] = 0;
+
+	internal_trace_recorder->buffer_offset     += sizeof( bfio_trace_file_record_t );
+	internal_trace_recorder->number_of_records += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_mutex_release(
+	 internal_trace_recorder->mutex,
+	 NULL );
+#endif
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Trace recorder functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBBFIO_TRACE_RECORDER_H )
+#define _LIBBFIO_TRACE_RECORDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_trace_file.h"
+#include "libbfio_extern.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The trace file format version
+ */
+#define LIBBFIO_TRACE_FILE_FORMAT_VERSION	1
+
+/* The number of records that are buffered before they are written
+ */
+#define LIBBFIO_TRACE_RECORDER_NUMBER_OF_BUFFERED_RECORDS	1024
+
+extern const uint8_t bfio_trace_file_signature[ 8 ];
+
+typedef struct libbfio_internal_trace_recorder libbfio_internal_trace_recorder_t;
+
+struct libbfio_internal_trace_recorder
+{
+	/* The output handle
+	 */
+	libbfio_handle_t *output_handle;
+
+	/* The timestamp of the start of the recording
+	 */
+	uint64_t start_timestamp;
+
+	/* The records buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size of the records buffer
+	 */
+	size_t buffer_size;
+
+	/* The offset in the records buffer
+	 */
+	size_t buffer_offset;
+
+	/* The number of records
+	 */
+	uint64_t number_of_records;
+
+	/* Value to indicate if writing the records failed
+	 */
+	uint8_t write_failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBBFIO_EXTERN \
+int libbfio_trace_recorder_initialize(
+     libbfio_trace_recorder_t **trace_recorder,
+     libbfio_handle_t *output_handle,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_trace_recorder_free(
+     libbfio_trace_recorder_t **trace_recorder,
+     libcerror_error_t **error );
+
+int libbfio_internal_trace_recorder_flush(
+     libbfio_internal_trace_recorder_t *internal_trace_recorder,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_trace_recorder_flush(
+     libbfio_trace_recorder_t *trace_recorder,
+     libcerror_error_t **error );
+
+LIBBFIO_EXTERN \
+int libbfio_trace_recorder_get_number_of_records(
+     libbfio_trace_recorder_t *trace_recorder,
+     uint64_t *number_of_records,
+     libcerror_error_t **error );
+
+void libbfio_trace_recorder_post_callback(
+      intptr_t *callback_data,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size,
+      int64_t result,
+      uint64_t duration );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_TRACE_RECORDER_H ) */
+
@@ -0,0 +1,636 @@
+/*
+ * Trace replay functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libbfio_trace_file.h"
+#include "libbfio_definitions.h"
+#include "libbfio_handle.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_libcthreads.h"
+#include "libbfio_pool.h"
+#include "libbfio_timestamp.h"
+#include "libbfio_trace_recorder.h"
+#include "libbfio_trace_replay.h"
+#include "libbfio_types.h"
+#include "libbfio_unused.h"
+
+/* Replays a trace against a pool
+ * The trace handle must be open for reading and contain a trace written
+ * by a trace recorder, the pool must contain the same entries as the pool
+ * that was traced, the records of a traced handle are replayed against entry 0
+ * Only the successful reads are replayed, using the offset that was read, hence
+ * the replay does not depend on the order of the seeks and does not modify data
+ * If number of threads is larger than 1 and multi-thread support is available
+ * the records are replayed in parallel, where every thread replays the records
+ * with an index that corresponds to the thread index modulo the number of threads
+ * Use LIBBFIO_TRACE_REPLAY_FLAG_PRESERVE_TIMING to replay the records at the time
+ * relative to the start of the recording, otherwise they are replayed as fast as possible
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_trace_replay(
+     libbfio_handle_t *trace_handle,
+     libbfio_pool_t *pool,
+     int number_of_threads,
+     uint8_t replay_flags,
+     uint64_t *replay_duration,
+     libcerror_error_t **error )
+{
+	bfio_trace_file_header_t file_header;
+
+	libbfio_internal_trace_replay_value_t *replay_values = NULL;
+	const bfio_trace_file_record_t *record               = NULL;
+	uint8_t *records_data                                = NULL;
+	static char *function                                = "libbfio_trace_replay";
+	size64_t trace_size                                  = 0;
+	size_t maximum_read_size                             = 0;
+	size_t number_of_records                             = 0;
+	size_t record_index                                  = 0;
+	size_t records_data_size                             = 0;
+	size_t replay_values_size                            = 0;
+	ssize_t read_count                                   = 0;
+	uint64_t end_timestamp                               = 0;
+	uint64_t start_timestamp                             = 0;
+	uint64_t value_64bit                                 = 0;
+	uint32_t format_version                              = 0;
+	uint32_t record_size                                 = 0;
+	int number_of_replay_values                          = 0;
+	int replay_value_index                               = 0;
+	int result                                           = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	libcthreads_thread_pool_t *thread_pool               = NULL;
+#endif
+
+	if( trace_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( replay_flags & ~( LIBBFIO_TRACE_REPLAY_FLAG_PRESERVE_TIMING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported replay flags: 0x%02" PRIx8 ".",
+		 function,
+		 replay_flags );
+
+		return( -1 );
+	}
+	if( replay_duration == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid replay duration.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     trace_handle,
+	     &trace_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve trace size.",
+		 function );
+
+		goto on_error;
+	}
+	if( trace_size < (size64_t) sizeof( bfio_trace_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid trace size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              trace_handle,
+	              (uint8_t *) &file_header,
+	              sizeof( bfio_trace_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( bfio_trace_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     file_header.signature,
+	     bfio_trace_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header.record_size,
+	 record_size );
+
+	if( format_version != LIBBFIO_TRACE_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	if( record_size != (uint32_t) sizeof( bfio_trace_file_record_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record size: %" PRIu32 ".",
+		 function,
+		 record_size );
+
+		goto on_error;
+	}
+	trace_size -= sizeof( bfio_trace_file_header_t );
+
+	if( trace_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid trace size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_records = (size_t) trace_size / sizeof( bfio_trace_file_record_t );
+	records_data_size = number_of_records * sizeof( bfio_trace_file_record_t );
+
+	if( records_data_size > 0 )
+	{
+		records_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * records_data_size );
+
+		if( records_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              trace_handle,
+		              records_data,
+		              records_data_size,
+		              (off64_t) sizeof( bfio_trace_file_header_t ),
+		              error );
+
+		if( read_count != (ssize_t) records_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		record = &( ( (const bfio_trace_file_record_t *) records_data )[ record_index ] );
+
+		if( record->operation != LIBBFIO_TRACE_OPERATION_READ )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 record->size,
+		 value_64bit );
+
+		if( value_64bit > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid record: %" PRIzd " size value exceeds maximum.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( (size_t) value_64bit > maximum_read_size )
+		{
+			maximum_read_size = (size_t) value_64bit;
+		}
+	}
+	number_of_replay_values = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( number_of_threads > 1 )
+	{
+		number_of_replay_values = number_of_threads;
+
+		if( (size_t) number_of_replay_values > number_of_records )
+		{
+			number_of_replay_values = (int) number_of_records;
+		}
+		if( number_of_replay_values < 1 )
+		{
+			number_of_replay_values = 1;
+		}
+	}
+#endif
+	replay_values_size = sizeof( libbfio_internal_trace_replay_value_t ) * number_of_replay_values;
+
+	replay_values = (libbfio_internal_trace_replay_value_t *) memory_allocate(
+	                                                           replay_values_size );
+
+	if( replay_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create replay values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     replay_values,
+	     0,
+	     replay_values_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear replay values.",
+		 function );
+
+		goto on_error;
+	}
+	for( replay_value_index = 0;
+	     replay_value_index < number_of_replay_values;
+	     replay_value_index++ )
+	{
+		if( maximum_read_size > 0 )
+		{
+			replay_values[ replay_value_index ].buffer = (uint8_t *) memory_allocate(
+			                                                          sizeof( uint8_t ) * maximum_read_size );
+
+			if( replay_values[ replay_value_index ].buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create read buffer: %d.",
+				 function,
+				 replay_value_index );
+
+				goto on_error;
+			}
+		}
+		replay_values[ replay_value_index ].pool                   = pool;
+		replay_values[ replay_value_index ].records_data           = records_data;
+		replay_values[ replay_value_index ].number_of_records      = number_of_records;
+		replay_values[ replay_value_index ].first_record_index     = (size_t) replay_value_index;
+		replay_values[ replay_value_index ].record_index_increment = (size_t) number_of_replay_values;
+		replay_values[ replay_value_index ].replay_flags           = replay_flags;
+		replay_values[ replay_value_index ].buffer_size            = maximum_read_size;
+		replay_values[ replay_value_index ].result                 = -1;
+	}
+	start_timestamp = libbfio_timestamp_get_monotonic();
+
+	for( replay_value_index = 0;
+	     replay_value_index < number_of_replay_values;
+	     replay_value_index++ )
+	{
+		replay_values[ replay_value_index ].start_timestamp = start_timestamp;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( number_of_replay_values > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_replay_values,
+		     number_of_replay_values,
+		     (int (*)(intptr_t *, void *)) &libbfio_internal_trace_replay_records,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( replay_value_index = 0;
+		     replay_value_index < number_of_replay_values;
+		     replay_value_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( replay_values[ replay_value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push replay value: %d onto thread pool queue.",
+				 function,
+				 replay_value_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		libbfio_internal_trace_replay_records(
+		 &( replay_values[ 0 ] ),
+		 NULL );
+	}
+	end_timestamp = libbfio_timestamp_get_monotonic();
+
+	if( end_timestamp > start_timestamp )
+	{
+		*replay_duration = end_timestamp - start_timestamp;
+	}
+	else
+	{
+		*replay_duration = 0;
+	}
+	for( replay_value_index = 0;
+	     replay_value_index < number_of_replay_values;
+	     replay_value_index++ )
+	{
+		if( replay_values[ replay_value_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to replay records of thread: %d.",
+			 function,
+			 replay_value_index );
+
+			result = -1;
+		}
+		if( replay_values[ replay_value_index ].buffer != NULL )
+		{
+			memory_free(
+			 replay_values[ replay_value_index ].buffer );
+		}
+	}
+	memory_free(
+	 replay_values );
+
+	if( records_data != NULL )
+	{
+		memory_free(
+		 records_data );
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( replay_values != NULL )
+	{
+		for( replay_value_index = 0;
+		     replay_value_index < number_of_replay_values;
+		     replay_value_index++ )
+		{
+			if( replay_values[ replay_value_index ].buffer != NULL )
+			{
+				memory_free(
+				 replay_values[ replay_value_index ].buffer );
+			}
+		}
+		memory_free(
+		 replay_values );
+	}
+	if( records_data != NULL )
+	{
+		memory_free(
+		 records_data );
+	}
+	return( -1 );
+}
+
+/* Replays the records of a replay value
+ * Callback function for the replay thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libbfio_internal_trace_replay_records(
+     libbfio_internal_trace_replay_value_t *replay_value,
+     void *arguments LIBBFIO_ATTRIBUTE_UNUSED )
+{
+	const bfio_trace_file_record_t *record = NULL;
+	size_t read_size                       = 0;
+	size_t record_index                    = 0;
+	ssize_t read_count                     = 0;
+	off64_t offset                         = 0;
+	uint64_t value_64bit                   = 0;
+	uint32_t value_32bit                   = 0;
+	int entry                              = 0;
+
+	LIBBFIO_UNREFERENCED_PARAMETER( arguments )
+
+	if( replay_value == NULL )
+	{
+		return( -1 );
+	}
+	replay_value->result = -1;
+
+	if( replay_value->record_index_increment == 0 )
+	{
+		return( -1 );
+	}
+	for( record_index = replay_value->first_record_index;
+	     record_index < replay_value->number_of_records;
+	     record_index += replay_value->record_index_increment )
+	{
+		record = &( ( (const bfio_trace_file_record_t *) replay_value->records_data )[ record_index ] );
+
+		if( record->operation != LIBBFIO_TRACE_OPERATION_READ )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 record->result,
+		 value_64bit );
+
+		if( (int64_t) value_64bit < 0 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 record->size,
+		 value_64bit );
+
+		read_size = (size_t) value_64bit;
+
+		if( ( read_size == 0 )
+		 || ( read_size > replay_value->buffer_size ) )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 record->offset,
+		 value_64bit );
+
+		offset = (off64_t) value_64bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 record->entry,
+		 value_32bit );
+
+		entry = (int) (int32_t) value_32bit;
+
+		if( entry < 0 )
+		{
+			entry = 0;
+		}
+		if( ( replay_value->replay_flags & LIBBFIO_TRACE_REPLAY_FLAG_PRESERVE_TIMING ) != 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 record->start_time,
+			 value_64bit );
+
+			libbfio_timestamp_wait_until(
+			 replay_value->start_timestamp + value_64bit );
+		}
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              replay_value->pool,
+		              entry,
+		              replay_value->buffer,
+		              read_size,
+		              offset,
+		              NULL );
+
+		if( read_count < 0 )
+		{
+			return( -1 );
+		}
+	}
+	replay_value->result = 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,100 @@
+/*
+ * Trace replay functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBBFIO_TRACE_REPLAY_H )
+#define _LIBBFIO_TRACE_REPLAY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libbfio_extern.h"
+#include "libbfio_libcerror.h"
+#include "libbfio_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libbfio_internal_trace_replay_value libbfio_internal_trace_replay_value_t;
+
+struct libbfio_internal_trace_replay_value
+{
+	/* The pool
+	 */
+	libbfio_pool_t *pool;
+
+	/* The records data
+	 */
+	const uint8_t *records_data;
+
+	/* The number of records
+	 */
+	size_t number_of_records;
+
+	/* The index of the first record that is replayed
+	 */
+	size_t first_record_index;
+
+	/* The number of records to skip after a replayed record
+	 */
+	size_t record_index_increment;
+
+	/* The replay flags
+	 */
+	uint8_t replay_flags;
+
+	/* The timestamp of the start of the replay
+	 */
+	uint64_t start_timestamp;
+
+	/* The read buffer
+	 */
+	uint8_t *buffer;
+
+	/* The size of the read buffer
+	 */
+	size_t buffer_size;
+
+	/* The result of the replay
+	 */
+	int result;
+};
+
+LIBBFIO_EXTERN \
+int libbfio_trace_replay(
+     libbfio_handle_t *trace_handle,
+     libbfio_pool_t *pool,
+     int number_of_threads,
+     uint8_t replay_flags,
+     uint64_t *replay_duration,
+     libcerror_error_t **error );
+
+int libbfio_internal_trace_replay_records(
+     libbfio_internal_trace_replay_value_t *replay_value,
+     void *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBBFIO_TRACE_REPLAY_H ) */
+
@@ -34,12 +34,16 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
-typedef struct libbfio_handle {}	libbfio_handle_t;
-typedef struct libbfio_pool {}		libbfio_pool_t;
+typedef struct libbfio_descriptor_manager {}	libbfio_descriptor_manager_t;
+typedef struct libbfio_handle {}		libbfio_handle_t;
+typedef struct libbfio_pool {}			libbfio_pool_t;
+typedef struct libbfio_trace_recorder {}	libbfio_trace_recorder_t;
 
 #else
+typedef intptr_t libbfio_descriptor_manager_t;
 typedef intptr_t libbfio_handle_t;
 typedef intptr_t libbfio_pool_t;
+typedef intptr_t libbfio_trace_recorder_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
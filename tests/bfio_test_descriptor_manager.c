@@ -0,0 +1,1312 @@
+/*
+ * Library descriptor_manager type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_descriptor_manager.h"
+
+/* Tests the libbfio_descriptor_manager_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_initialize(
+     void )
+{
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libcerror_error_t *error                         = NULL;
+	int maximum_number_of_open_handles               = 0;
+	int result                                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with the maximum number of open handles determined automatically
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          LIBBFIO_DESCRIPTOR_MANAGER_AUTOMATIC_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+	          descriptor_manager,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	descriptor_manager = (libbfio_descriptor_manager_t *) 0x12345678UL;
+
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          16,
+	          &error );
+
+	descriptor_manager = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_manager_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_descriptor_manager_get_default_maximum_number_of_open_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_get_default_maximum_number_of_open_handles(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	int maximum_number_of_open_handles = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_get_default_maximum_number_of_open_handles(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_manager_acquire_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_acquire_handle(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libbfio_handle_t *first_handle                   = NULL;
+	libbfio_handle_t *second_handle                  = NULL;
+	libcerror_error_t *error                         = NULL;
+	int number_of_open_handles                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_set(
+	          first_handle,
+	          data,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_set_descriptor_manager(
+	          first_handle,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_open(
+	          first_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_initialize(
+	          &second_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_set(
+	          second_handle,
+	          data,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_set_descriptor_manager(
+	          second_handle,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_open(
+	          second_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_manager_acquire_handle(
+	          descriptor_manager,
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_release_handle(
+	          descriptor_manager,
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Acquiring the second handle closes the least recently used first handle
+	 */
+	result = libbfio_descriptor_manager_acquire_handle(
+	          descriptor_manager,
+	          second_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Handles that are in use are not closed, the maximum is exceeded instead
+	 */
+	result = libbfio_descriptor_manager_acquire_handle(
+	          descriptor_manager,
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          second_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 2 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_release_handle(
+	          descriptor_manager,
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_release_handle(
+	          descriptor_manager,
+	          second_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_acquire_handle(
+	          NULL,
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_acquire_handle(
+	          descriptor_manager,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test acquiring a handle that does not refer to the descriptor manager
+	 */
+	result = libbfio_handle_set_descriptor_manager(
+	          first_handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_acquire_handle(
+	          descriptor_manager,
+	          first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &second_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_free(
+	          &first_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Freeing the handles removes them from the descriptor manager
+	 */
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 0 );
+
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &second_handle,
+		 NULL );
+	}
+	if( first_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &first_handle,
+		 NULL );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_manager_remove_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_remove_handle(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libbfio_handle_t *handle                         = NULL;
+	libcerror_error_t *error                         = NULL;
+	int number_of_open_handles                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          data,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_set_descriptor_manager(
+	          handle,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_acquire_handle(
+	          descriptor_manager,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_release_handle(
+	          descriptor_manager,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_manager_remove_handle(
+	          descriptor_manager,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Removing a handle that was not added is not an error
+	 */
+	result = libbfio_descriptor_manager_remove_handle(
+	          descriptor_manager,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_remove_handle(
+	          NULL,
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_remove_handle(
+	          descriptor_manager,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_descriptor_manager_get_number_of_open_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_get_number_of_open_handles(
+     void )
+{
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libcerror_error_t *error                         = NULL;
+	int number_of_open_handles                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          NULL,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_descriptor_manager_get_maximum_number_of_open_handles and
+ * libbfio_descriptor_manager_set_maximum_number_of_open_handles functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_descriptor_manager_set_maximum_number_of_open_handles(
+     void )
+{
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libcerror_error_t *error                         = NULL;
+	int maximum_number_of_open_handles               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+	          descriptor_manager,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_set_maximum_number_of_open_handles(
+	          descriptor_manager,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+	          descriptor_manager,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+	          NULL,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_get_maximum_number_of_open_handles(
+	          descriptor_manager,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_set_maximum_number_of_open_handles(
+	          NULL,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_descriptor_manager_set_maximum_number_of_open_handles(
+	          descriptor_manager,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BFIO_TEST_UNREFERENCED_PARAMETER( argc )
+	BFIO_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_initialize",
+	 bfio_test_descriptor_manager_initialize );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_free",
+	 bfio_test_descriptor_manager_free );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_get_default_maximum_number_of_open_handles",
+	 bfio_test_descriptor_manager_get_default_maximum_number_of_open_handles );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_acquire_handle",
+	 bfio_test_descriptor_manager_acquire_handle );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_remove_handle",
+	 bfio_test_descriptor_manager_remove_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_get_number_of_open_handles",
+	 bfio_test_descriptor_manager_get_number_of_open_handles );
+
+	BFIO_TEST_RUN(
+	 "libbfio_descriptor_manager_set_maximum_number_of_open_handles",
+	 bfio_test_descriptor_manager_set_maximum_number_of_open_handles );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
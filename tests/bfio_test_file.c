@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -30,6 +31,10 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
 #include "bfio_test_functions.h"
 #include "bfio_test_getopt.h"
 #include "bfio_test_libbfio.h"
@@ -49,6 +54,40 @@
 #define BFIO_TEST_FILE_VERBOSE
  */
 
+#if defined( __GNUC__ ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+#define HAVE_BFIO_TEST_FILE_CONCURRENT_READ	1
+#endif
+
+#if defined( HAVE_BFIO_TEST_FILE_CONCURRENT_READ )
+
+/* The number of threads and iterations of the concurrent read test
+ */
+#define BFIO_TEST_FILE_NUMBER_OF_THREADS	4
+#define BFIO_TEST_FILE_NUMBER_OF_ITERATIONS	1000
+
+typedef struct bfio_test_file_read_values bfio_test_file_read_values_t;
+
+struct bfio_test_file_read_values
+{
+	/* The file handle shared by the threads
+	 */
+	libbfio_handle_t *handle;
+
+	/* The data read from the start of the file
+	 */
+	uint8_t reference_data[ 4096 ];
+
+	/* The size of the reference data
+	 */
+	size_t reference_data_size;
+
+	/* The number of failed or incorrect reads
+	 */
+	int number_of_failures;
+};
+
+#endif /* defined( HAVE_BFIO_TEST_FILE_CONCURRENT_READ ) */
+
 /* Tests the libbfio_file_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -891,6 +930,225 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+#if defined( HAVE_BFIO_TEST_FILE_CONCURRENT_READ )
+
+/* Reads a file handle at varying offsets
+ */
+void *bfio_test_file_read_thread(
+       void *arguments )
+{
+	uint8_t buffer[ 64 ];
+
+	bfio_test_file_read_values_t *read_values = NULL;
+	size_t read_size                          = 0;
+	ssize_t read_count                        = 0;
+	off64_t offset                            = 0;
+	int iteration                             = 0;
+
+	read_values = (bfio_test_file_read_values_t *) arguments;
+
+	for( iteration = 0;
+	     iteration < BFIO_TEST_FILE_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		offset    = (off64_t) ( ( (size_t) iteration * 61 ) % read_values->reference_data_size );
+		read_size = read_values->reference_data_size - (size_t) offset;
+
+		if( read_size > 64 )
+		{
+			read_size = 64;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              read_values->handle,
+		              buffer,
+		              read_size,
+		              offset,
+		              NULL );
+
+		if( ( read_count != (ssize_t) read_size )
+		 || ( memory_compare(
+		       buffer,
+		       &( read_values->reference_data[ offset ] ),
+		       read_size ) != 0 ) )
+		{
+			__atomic_add_fetch(
+			 &( read_values->number_of_failures ),
+			 1,
+			 __ATOMIC_SEQ_CST );
+		}
+	}
+	return( NULL );
+}
+
+/* Tests concurrent reads at an offset of the same file handle
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_concurrent_read(
+     libbfio_handle_t *handle )
+{
+	bfio_test_file_read_values_t read_values;
+	pthread_t threads[ BFIO_TEST_FILE_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+	int thread_index         = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &read_values,
+	     0,
+	     sizeof( bfio_test_file_read_values_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	read_values.handle = handle;
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer(
+	              handle,
+	              read_values.reference_data,
+	              4096,
+	              &error );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "read_count",
+	 (int) read_count,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_values.reference_data_size = (size_t) read_count;
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < BFIO_TEST_FILE_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &bfio_test_file_read_thread,
+		          &read_values );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_threads++;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	number_of_threads = 0;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "read_values.number_of_failures",
+	 read_values.number_of_failures,
+	 0 );
+
+	/* The current offset is set to the end of the data read
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              read_values.reference_data,
+	              1,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	libbfio_handle_close(
+	 handle,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_BFIO_TEST_FILE_CONCURRENT_READ ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1036,6 +1294,15 @@ int main(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+#if defined( HAVE_BFIO_TEST_FILE_CONCURRENT_READ )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_concurrent_read",
+		 bfio_test_file_concurrent_read,
+		 handle );
+
+#endif /* defined( HAVE_BFIO_TEST_FILE_CONCURRENT_READ ) */
+
 		/* Clean up
 		 */
 		result = libbfio_handle_free(
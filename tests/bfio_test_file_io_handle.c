@@ -33,6 +33,7 @@
 #include "bfio_test_functions.h"
 #include "bfio_test_getopt.h"
 #include "bfio_test_libbfio.h"
+#include "bfio_test_libcdata.h"
 #include "bfio_test_libcerror.h"
 #include "bfio_test_libcfile.h"
 #include "bfio_test_libclocale.h"
@@ -40,6 +41,7 @@
 #include "bfio_test_macros.h"
 #include "bfio_test_memory.h"
 
+#include "../libbfio/libbfio_extent.h"
 #include "../libbfio/libbfio_file_io_handle.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -2075,6 +2077,190 @@ on_error:
 	return( 0 );
 }
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET )
+
+/* Tests the libbfio_file_io_handle_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_read_buffer_at_offset(
+     libbfio_file_io_handle_t *file_io_handle )
+{
+	uint8_t buffer[ 16 ];
+	uint8_t reference_buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_io_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_file_io_handle_read_buffer(
+	              file_io_handle,
+	              reference_buffer,
+	              32,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              16,
+	              8,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( reference_buffer[ 8 ] ),
+	          16 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Reading at an offset does not change the current offset
+	 */
+	offset = libbfio_file_io_handle_seek_offset(
+	          file_io_handle,
+	          0,
+	          SEEK_CUR,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libbfio_file_io_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET ) */
+
 /* Tests the libbfio_file_io_handle_write_buffer function
  * Returns 1 if successful or 0 if not
  */
@@ -2878,6 +3064,264 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbfio_file_io_handle_set_access_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_set_access_hint(
+     libbfio_file_io_handle_t *file_io_handle )
+{
+	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_io_handle_set_access_hint(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that no range access hint is applied to a file IO handle that is not open
+	 */
+	result = libbfio_file_io_handle_initialize(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_set_access_hint(
+	          closed_file_io_handle,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_free(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_set_access_hint(
+	          NULL,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &closed_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_file_io_handle_get_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_file_io_handle_get_extents(
+     libbfio_file_io_handle_t *file_io_handle )
+{
+	libbfio_file_io_handle_t *closed_file_io_handle = NULL;
+	libcdata_array_t *extents_array                 = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_array_initialize(
+	          &extents_array,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_file_io_handle_get_extents(
+	          file_io_handle,
+	          extents_array,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_file_io_handle_get_extents(
+	          NULL,
+	          extents_array,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get extents of a file IO handle with a name that is not open
+	 */
+	result = libbfio_file_io_handle_clone(
+	          &closed_file_io_handle,
+	          file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_io_handle_get_extents(
+	          closed_file_io_handle,
+	          extents_array,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_file_io_handle_free(
+	          &closed_file_io_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &extents_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( closed_file_io_handle != NULL )
+	{
+		libbfio_file_io_handle_free(
+		 &closed_file_io_handle,
+		 NULL );
+	}
+	if( extents_array != NULL )
+	{
+		libcdata_array_free(
+		 &extents_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libbfio_extent_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libbfio_file_io_handle_get_size function
  * Returns 1 if successful or 0 if not
  */
@@ -3185,6 +3629,15 @@ int main(
 		 bfio_test_file_io_handle_read_buffer,
 		 file_io_handle );
 
+#if defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_read_buffer_at_offset",
+		 bfio_test_file_io_handle_read_buffer_at_offset,
+		 file_io_handle );
+
+#endif /* defined( LIBBFIO_FILE_IO_HANDLE_HAVE_READ_AT_OFFSET ) */
+
 		BFIO_TEST_RUN_WITH_ARGS(
 		 "libbfio_file_io_handle_exists",
 		 bfio_test_file_io_handle_exists,
@@ -3200,6 +3653,16 @@ int main(
 		 bfio_test_file_io_handle_get_size,
 		 file_io_handle );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_set_access_hint",
+		 bfio_test_file_io_handle_set_access_hint,
+		 file_io_handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_file_io_handle_get_extents",
+		 bfio_test_file_io_handle_get_extents,
+		 file_io_handle );
+
 		/* Clean up
 		 */
 		result = libbfio_file_io_handle_close(
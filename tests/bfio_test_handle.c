@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -39,13 +40,19 @@
 #include "bfio_test_macros.h"
 #include "bfio_test_memory.h"
 #include "bfio_test_rwlock.h"
+#include "bfio_test_unused.h"
 
+#include "../libbfio/libbfio_extent.h"
 #include "../libbfio/libbfio_handle.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
 #endif
 
+libbfio_io_operations_t bfio_test_handle_io_operations;
+
+uint8_t bfio_test_handle_tracked_data[ 1024 ];
+
 /* Creates and opens a source handle
  * Returns 1 if successful or -1 on error
  */
@@ -209,7 +216,7 @@ int bfio_test_handle_initialize(
 	int result                      = 0;
 
 #if defined( HAVE_BFIO_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 3;
+	int number_of_malloc_fail_tests = 4;
 	int number_of_memset_fail_tests = 1;
 	int test_number                 = 0;
 #endif
@@ -453,6 +460,203 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbfio_handle_initialize_with_operations function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_initialize_with_operations(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_initialize_with_operations(
+	          &handle,
+	          NULL,
+	          &bfio_test_handle_io_operations,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "io_operations",
+	 (int) ( ( (libbfio_internal_handle_t *) handle )->io_operations == &bfio_test_handle_io_operations ),
+	 1 );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a single threaded handle, which has no read/write lock
+	 */
+	result = libbfio_handle_initialize_with_operations(
+	          &handle,
+	          NULL,
+	          &bfio_test_handle_io_operations,
+	          LIBBFIO_FLAG_SINGLE_THREADED,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBBFIO )
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "read_write_lock",
+	 ( (libbfio_internal_handle_t *) handle )->read_write_lock );
+#endif
+
+	result = libbfio_handle_set_track_offsets_read(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_initialize_with_operations(
+	          NULL,
+	          NULL,
+	          &bfio_test_handle_io_operations,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle = (libbfio_handle_t *) 0x12345678UL;
+
+	result = libbfio_handle_initialize_with_operations(
+	          &handle,
+	          NULL,
+	          &bfio_test_handle_io_operations,
+	          0,
+	          &error );
+
+	handle = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_initialize_with_operations(
+	          &handle,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libbfio_handle_free function
  * Returns 1 if successful or 0 if not
  */
@@ -924,13 +1128,14 @@ int bfio_test_handle_open(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
+	libbfio_io_operations_t test_io_operations;
 
-	libbfio_handle_t *handle = NULL;
-	libcerror_error_t *error = NULL;
-	intptr_t *io_handle      = NULL;
-	intptr_t *open_function  = NULL;
-	size_t source_length     = 0;
-	int result               = 0;
+	libbfio_handle_t *handle                     = NULL;
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	size_t source_length                         = 0;
+	int result                                   = 0;
 
 	/* Initialize test
 	 */
@@ -1042,16 +1247,19 @@ int bfio_test_handle_open(
 	libcerror_error_free(
 	 &error );
 
-	open_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->open;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
+
+	test_io_operations.open = NULL;
 
-	( (libbfio_internal_handle_t *) handle )->open = NULL;
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_open(
 	          handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->open = (int (*)(intptr_t *, int, libcerror_error_t **)) open_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1217,15 +1425,14 @@ int bfio_test_handle_reopen(
      const system_character_t *source )
 {
 	char narrow_source[ 256 ];
+	libbfio_io_operations_t test_io_operations;
 
-	libbfio_handle_t *handle       = NULL;
-	libcerror_error_t *error       = NULL;
-	intptr_t *close_function       = NULL;
-	intptr_t *io_handle            = NULL;
-	intptr_t *open_function        = NULL;
-	intptr_t *seek_offset_function = NULL;
-	size_t source_length           = 0;
-	int result                     = 0;
+	libbfio_handle_t *handle                     = NULL;
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	size_t source_length                         = 0;
+	int result                                   = 0;
 
 	/* Initialize test
 	 */
@@ -1351,16 +1558,19 @@ int bfio_test_handle_reopen(
 	libcerror_error_free(
 	 &error );
 
-	close_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->close;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->close = NULL;
+	test_io_operations.close = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_reopen(
 	          handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->close = (int (*)(intptr_t *, libcerror_error_t **)) close_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1374,16 +1584,19 @@ int bfio_test_handle_reopen(
 	libcerror_error_free(
 	 &error );
 
-	open_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->open;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
+
+	test_io_operations.open = NULL;
 
-	( (libbfio_internal_handle_t *) handle )->open = NULL;
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_reopen(
 	          handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->open = (int (*)(intptr_t *, int, libcerror_error_t **)) open_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1397,16 +1610,19 @@ int bfio_test_handle_reopen(
 	libcerror_error_free(
 	 &error );
 
-	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+	test_io_operations.seek_offset = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_reopen(
 	          handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1550,11 +1766,13 @@ on_error:
 int bfio_test_handle_close(
      void )
 {
-	libbfio_handle_t *handle = NULL;
-	libcerror_error_t *error = NULL;
-	intptr_t *close_function = NULL;
-	intptr_t *io_handle      = NULL;
-	int result               = 0;
+	libbfio_io_operations_t test_io_operations;
+
+	libbfio_handle_t *handle                     = NULL;
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	int result                                   = 0;
 
 	/* Initialize test
 	 */
@@ -1615,15 +1833,18 @@ int bfio_test_handle_close(
 	libcerror_error_free(
 	 &error );
 
-	close_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->close;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->close = NULL;
+	test_io_operations.close = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_close(
 	          handle,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->close = (int (*)(intptr_t *, libcerror_error_t **)) close_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1731,26 +1952,41 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
 
-/* Tests the libbfio_internal_handle_read_buffer function
+/* Tests the libbfio_internal_handle_close_if_open function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_internal_handle_read_buffer(
-     libbfio_handle_t *handle )
+int bfio_test_internal_handle_close_if_open(
+     void )
 {
-	uint8_t buffer[ 32 ];
+	uint8_t data[ 16 ];
 
+	libbfio_handle_t *handle = NULL;
 	libcerror_error_t *error = NULL;
-	intptr_t *read_function  = NULL;
-	size64_t file_size       = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
 	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_handle_get_size(
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
 	          handle,
-	          &file_size,
+	          data,
+	          16,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -1762,43 +1998,184 @@ int bfio_test_internal_handle_read_buffer(
 	 "error",
 	 error );
 
-	if( file_size < 32 )
-	{
-		return( 1 );
-	}
-	offset = libbfio_handle_seek_offset(
+	result = libbfio_handle_open(
 	          handle,
-	          0,
-	          SEEK_SET,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	( (libbfio_internal_handle_t *) handle )->access_flags |= LIBBFIO_ACCESS_FLAG_TRUNCATE;
+
 	/* Test regular cases
 	 */
-	read_count = libbfio_internal_handle_read_buffer(
-	              (libbfio_internal_handle_t *) handle,
-	              buffer,
-	              32,
-	              &error );
+	result = libbfio_internal_handle_close_if_open(
+	          (libbfio_internal_handle_t *) handle,
+	          &error );
 
-	BFIO_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) 32 );
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	BFIO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "access_flags",
+	 (int) ( ( (libbfio_internal_handle_t *) handle )->access_flags & LIBBFIO_ACCESS_FLAG_TRUNCATE ),
+	 0 );
+
+	/* A handle that is already closed is not an error
+	 */
+	result = libbfio_internal_handle_close_if_open(
+	          (libbfio_internal_handle_t *) handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_handle_close_if_open(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_internal_handle_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_handle_read_buffer(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ 32 ];
+	libbfio_io_operations_t test_io_operations;
+
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	size64_t file_size                           = 0;
+	ssize_t read_count                           = 0;
+	off64_t offset                               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &file_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file_size < 32 )
+	{
+		return( 1 );
+	}
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_internal_handle_read_buffer(
+	              (libbfio_internal_handle_t *) handle,
+	              buffer,
+	              32,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
 	 */
 	read_count = libbfio_internal_handle_read_buffer(
 	              NULL,
@@ -1818,9 +2195,12 @@ int bfio_test_internal_handle_read_buffer(
 	libcerror_error_free(
 	 &error );
 
-	read_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->read;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
+
+	test_io_operations.read = NULL;
 
-	( (libbfio_internal_handle_t *) handle )->read = NULL;
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	read_count = libbfio_internal_handle_read_buffer(
 	              (libbfio_internal_handle_t *) handle,
@@ -1828,7 +2208,7 @@ int bfio_test_internal_handle_read_buffer(
 	              32,
 	              &error );
 
-	( (libbfio_internal_handle_t *) handle )->read = (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) read_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
@@ -2352,12 +2732,14 @@ int bfio_test_internal_handle_write_buffer(
 		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
 		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '0', '1', '2', '3', '4', '5' };
 
-	libbfio_handle_t *handle = NULL;
-	libcerror_error_t *error = NULL;
-	intptr_t *write_function = NULL;
-	ssize_t write_count      = 0;
-	int result               = 0;
-	int with_temporary_file  = 0;
+	libbfio_io_operations_t test_io_operations;
+
+	libbfio_handle_t *handle                     = NULL;
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	ssize_t write_count                          = 0;
+	int result                                   = 0;
+	int with_temporary_file                      = 0;
 
 	/* Initialize test
 	 */
@@ -2462,9 +2844,12 @@ int bfio_test_internal_handle_write_buffer(
 	libcerror_error_free(
 	 &error );
 
-	write_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->write;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->write = NULL;
+	test_io_operations.write = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	write_count = libbfio_internal_handle_write_buffer(
 	               (libbfio_internal_handle_t *) handle,
@@ -2472,7 +2857,7 @@ int bfio_test_internal_handle_write_buffer(
 	               32,
 	               &error );
 
-	( (libbfio_internal_handle_t *) handle )->write = (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) write_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_SSIZE(
 	 "write_count",
@@ -3260,14 +3645,16 @@ on_error:
 int bfio_test_internal_handle_seek_offset(
      libbfio_handle_t *handle )
 {
-	libbfio_handle_t *closed_handle = NULL;
-	libcerror_error_t *error        = NULL;
-	intptr_t *io_handle             = NULL;
-	intptr_t *seek_offset_function  = NULL;
-	size64_t file_size              = 0;
-	off64_t offset                  = 0;
-	off64_t seek_offset             = 0;
-	int result                      = 0;
+	libbfio_io_operations_t test_io_operations;
+
+	libbfio_handle_t *closed_handle              = NULL;
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	size64_t file_size                           = 0;
+	off64_t offset                               = 0;
+	off64_t seek_offset                          = 0;
+	int result                                   = 0;
 
 	/* Initialize test
 	 */
@@ -3526,9 +3913,12 @@ int bfio_test_internal_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+	test_io_operations.seek_offset = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	offset = libbfio_internal_handle_seek_offset(
 	          (libbfio_internal_handle_t *) handle,
@@ -3536,7 +3926,7 @@ int bfio_test_internal_handle_seek_offset(
 	          SEEK_SET,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
@@ -3705,14 +4095,16 @@ on_error:
 int bfio_test_handle_seek_offset(
      libbfio_handle_t *handle )
 {
-	libbfio_handle_t *closed_handle = NULL;
-	libcerror_error_t *error        = NULL;
-	intptr_t *io_handle             = NULL;
-	intptr_t *seek_offset_function  = NULL;
-	size64_t file_size              = 0;
-	off64_t offset                  = 0;
-	off64_t seek_offset             = 0;
-	int result                      = 0;
+	libbfio_io_operations_t test_io_operations;
+
+	libbfio_handle_t *closed_handle              = NULL;
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	size64_t file_size                           = 0;
+	off64_t offset                               = 0;
+	off64_t seek_offset                          = 0;
+	int result                                   = 0;
 
 	/* Initialize test
 	 */
@@ -3971,9 +4363,12 @@ int bfio_test_handle_seek_offset(
 	libcerror_error_free(
 	 &error );
 
-	seek_offset_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->seek_offset;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = NULL;
+	test_io_operations.seek_offset = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	offset = libbfio_handle_seek_offset(
 	          handle,
@@ -3981,7 +4376,7 @@ int bfio_test_handle_seek_offset(
 	          SEEK_SET,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) seek_offset_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
@@ -4208,10 +4603,12 @@ on_error:
 int bfio_test_handle_exists(
      libbfio_handle_t *handle )
 {
-	libcerror_error_t *error  = NULL;
-	intptr_t *exists_function = NULL;
-	intptr_t *io_handle       = NULL;
-	int result                = 0;
+	libbfio_io_operations_t test_io_operations;
+
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	int result                                   = 0;
 
 	/* Test regular cases
 	 */
@@ -4268,15 +4665,18 @@ int bfio_test_handle_exists(
 	libcerror_error_free(
 	 &error );
 
-	exists_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->exists;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->exists = NULL;
+	test_io_operations.exists = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_exists(
 	          handle,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->exists = (int (*)(intptr_t *, libcerror_error_t **)) exists_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -4363,10 +4763,12 @@ on_error:
 int bfio_test_handle_is_open(
      libbfio_handle_t *handle )
 {
-	libcerror_error_t *error   = NULL;
-	intptr_t *io_handle        = NULL;
-	intptr_t *is_open_function = NULL;
-	int result                 = 0;
+	libbfio_io_operations_t test_io_operations;
+
+	libcerror_error_t *error                     = NULL;
+	const libbfio_io_operations_t *io_operations = NULL;
+	intptr_t *io_handle                          = NULL;
+	int result                                   = 0;
 
 	/* Test regular cases
 	 */
@@ -4423,15 +4825,18 @@ int bfio_test_handle_is_open(
 	libcerror_error_free(
 	 &error );
 
-	is_open_function = (intptr_t *) ( (libbfio_internal_handle_t *) handle )->is_open;
+	io_operations      = ( (libbfio_internal_handle_t *) handle )->io_operations;
+	test_io_operations = *io_operations;
 
-	( (libbfio_internal_handle_t *) handle )->is_open = NULL;
+	test_io_operations.is_open = NULL;
+
+	( (libbfio_internal_handle_t *) handle )->io_operations = &test_io_operations;
 
 	result = libbfio_handle_is_open(
 	          handle,
 	          &error );
 
-	( (libbfio_internal_handle_t *) handle )->is_open = (int (*)(intptr_t *, libcerror_error_t **)) is_open_function;
+	( (libbfio_internal_handle_t *) handle )->io_operations = io_operations;
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -5100,6 +5505,7 @@ int bfio_test_handle_get_size(
 {
 	libcerror_error_t *error = NULL;
 	intptr_t *io_handle      = NULL;
+	size64_t cached_size     = 0;
 	size64_t size            = 0;
 	int result               = 0;
 
@@ -5119,6 +5525,27 @@ int bfio_test_handle_get_size(
 	 "error",
 	 error );
 
+	/* Test retrieving the cached size
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &cached_size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "cached_size",
+	 (uint64_t) cached_size,
+	 (uint64_t) size );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libbfio_handle_get_size(
@@ -5733,10 +6160,109 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libbfio_handle_set_track_offsets_read function
+/* Creates a memory range handle with offsets read tracking
+ * of which the first block was read twice and the third block once
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_handle_open_tracked_memory_range(
+     libbfio_handle_t **handle,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 88 ];
+
+	ssize_t read_count = 0;
+
+	if( memory_set(
+	     bfio_test_handle_tracked_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     *handle,
+	     bfio_test_handle_tracked_data,
+	     1024,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_set_track_offsets_read(
+	     *handle,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_set_offsets_read_block_size(
+	     *handle,
+	     256,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              *handle,
+	              buffer,
+	              64,
+	              0,
+	              error );
+
+	if( read_count != 64 )
+	{
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              *handle,
+	              buffer,
+	              64,
+	              0,
+	              error );
+
+	if( read_count != 64 )
+	{
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              *handle,
+	              buffer,
+	              88,
+	              512,
+	              error );
+
+	if( read_count != 88 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *handle != NULL )
+	{
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libbfio_handle_set_offsets_read_block_size function
  * Returns 1 if successful or 0 if not
  */
-int bfio_test_handle_set_track_offsets_read(
+int bfio_test_handle_set_offsets_read_block_size(
      void )
 {
 	libbfio_handle_t *handle = NULL;
@@ -5745,20 +6271,8 @@ int bfio_test_handle_set_track_offsets_read(
 
 	/* Initialize test
 	 */
-	result = libbfio_handle_initialize(
+	result = bfio_test_handle_open_tracked_memory_range(
 	          &handle,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
 	          &error );
 
 	BFIO_TEST_ASSERT_EQUAL_INT(
@@ -5766,8 +6280,2896 @@ int bfio_test_handle_set_track_offsets_read(
 	 result,
 	 1 );
 
-	BFIO_TEST_ASSERT_IS_NOT_NULL(
-	 "handle",
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_offsets_read_block_size(
+	          handle,
+	          512,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "offsets_read_block_size",
+	 ( (libbfio_internal_handle_t *) handle )->offsets_read_block_size,
+	 (uint64_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "offsets_read_counts",
+	 ( (libbfio_internal_handle_t *) handle )->offsets_read_counts );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_offsets_read_block_size(
+	          NULL,
+	          512,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_offsets_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_offsets_read(
+     void )
+{
+	size64_t sizes[ 4 ];
+	off64_t offsets[ 4 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int number_of_ranges     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_handle_open_tracked_memory_range(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 2 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 0 ]",
+	 (int64_t) offsets[ 0 ],
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 0 ]",
+	 (uint64_t) sizes[ 0 ],
+	 (uint64_t) 64 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 1 ]",
+	 (int64_t) offsets[ 1 ],
+	 (int64_t) 512 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 1 ]",
+	 (uint64_t) sizes[ 1 ],
+	 (uint64_t) 88 );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_offsets_read(
+	          NULL,
+	          offsets,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          NULL,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          offsets,
+	          NULL,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          -1,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          4,
+	          NULL,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with too few ranges
+	 */
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          1,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_offsets_not_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_offsets_not_read(
+     void )
+{
+	size64_t sizes[ 4 ];
+	off64_t offsets[ 4 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int number_of_ranges     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_handle_open_tracked_memory_range(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 2 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 0 ]",
+	 (int64_t) offsets[ 0 ],
+	 (int64_t) 64 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 0 ]",
+	 (uint64_t) sizes[ 0 ],
+	 (uint64_t) 448 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 1 ]",
+	 (int64_t) offsets[ 1 ],
+	 (int64_t) 600 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 1 ]",
+	 (uint64_t) sizes[ 1 ],
+	 (uint64_t) 424 );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_offsets_not_read(
+	          NULL,
+	          offsets,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          NULL,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          offsets,
+	          NULL,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          -1,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          4,
+	          NULL,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with too few ranges
+	 */
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          1,
+	          &number_of_ranges,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_offsets_read_heatmap function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_offsets_read_heatmap(
+     void )
+{
+	uint32_t read_counts[ 4 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_handle_open_tracked_memory_range(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_offsets_read_heatmap(
+	          handle,
+	          read_counts,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "read_counts[ 0 ]",
+	 read_counts[ 0 ],
+	 (uint32_t) 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "read_counts[ 1 ]",
+	 read_counts[ 1 ],
+	 (uint32_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "read_counts[ 2 ]",
+	 read_counts[ 2 ],
+	 (uint32_t) 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "read_counts[ 3 ]",
+	 read_counts[ 3 ],
+	 (uint32_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_offsets_read_heatmap(
+	          NULL,
+	          read_counts,
+	          4,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_offsets_read_heatmap(
+	          handle,
+	          NULL,
+	          4,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with read counts not tracked
+	 */
+	result = libbfio_handle_set_offsets_read_block_size(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_offsets_read_heatmap(
+	          handle,
+	          read_counts,
+	          4,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_offsets_read_tracking_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_offsets_read_tracking_mode(
+     void )
+{
+	uint8_t buffer[ 32 ];
+	size64_t sizes[ 4 ];
+	off64_t offsets[ 4 ];
+
+	libbfio_handle_t *handle   = NULL;
+	libcerror_error_t *error   = NULL;
+	ssize_t read_count         = 0;
+	int number_of_offsets_read = 0;
+	int number_of_ranges       = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_handle_open_tracked_memory_range(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_offsets_read_tracking_mode(
+	          handle,
+	          LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              768,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 32 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* In the blocks tracking mode the offset ranges read are no longer tracked
+	 */
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          &number_of_offsets_read,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_offsets_read",
+	 number_of_offsets_read,
+	 2 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_offsets_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 2 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 0 ]",
+	 (int64_t) offsets[ 0 ],
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 0 ]",
+	 (uint64_t) sizes[ 0 ],
+	 (uint64_t) 256 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 1 ]",
+	 (int64_t) offsets[ 1 ],
+	 (int64_t) 512 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 1 ]",
+	 (uint64_t) sizes[ 1 ],
+	 (uint64_t) 512 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_offsets_not_read(
+	          handle,
+	          offsets,
+	          sizes,
+	          4,
+	          &number_of_ranges,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offsets[ 0 ]",
+	 (int64_t) offsets[ 0 ],
+	 (int64_t) 256 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "sizes[ 0 ]",
+	 (uint64_t) sizes[ 0 ],
+	 (uint64_t) 256 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_offsets_read_tracking_mode(
+	          NULL,
+	          LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_offsets_read_tracking_mode(
+	          handle,
+	          -1,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test blocks tracking mode without a block size
+	 */
+	result = libbfio_handle_set_offsets_read_block_size(
+	          handle,
+	          0,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_offsets_read_tracking_mode(
+	          handle,
+	          LIBBFIO_OFFSETS_READ_TRACKING_MODE_RANGES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_offsets_read_block_size(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_offsets_read_tracking_mode(
+	          handle,
+	          LIBBFIO_OFFSETS_READ_TRACKING_MODE_BLOCKS,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_offsets_read_sampling_interval function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_offsets_read_sampling_interval(
+     void )
+{
+	uint8_t buffer[ 32 ];
+	uint32_t read_counts[ 4 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int read_index           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_handle_open_tracked_memory_range(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_offsets_read_sampling_interval(
+	          handle,
+	          2,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( read_index = 0;
+	     read_index < 4;
+	     read_index++ )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              32,
+		              256,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 32 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_handle_get_offsets_read_heatmap(
+	          handle,
+	          read_counts,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "read_counts[ 1 ]",
+	 read_counts[ 1 ],
+	 (uint32_t) 2 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_offsets_read_sampling_interval(
+	          NULL,
+	          2,
+	          &error );
+
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_internal_handle_merge_staged_offsets_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_handle_merge_staged_offsets_read(
+     void )
+{
+	uint8_t buffer[ 1 ];
+
+	libbfio_handle_t *handle            = NULL;
+	libbfio_offsets_read_stage_t *stage = NULL;
+	libcerror_error_t *error            = NULL;
+	size64_t size                       = 0;
+	ssize_t read_count                  = 0;
+	off64_t offset                      = 0;
+	int number_of_offsets_read          = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = bfio_test_handle_open_tracked_memory_range(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The reads of a single thread are staged in a single stage
+	 */
+	stage = ( (libbfio_internal_handle_t *) handle )->offsets_read_stages;
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "stage",
+	 stage );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "stage->next_stage",
+	 stage->next_stage );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "stage->number_of_offsets_read",
+	 stage->number_of_offsets_read,
+	 3 );
+
+	/* Test regular cases
+	 */
+	result = libbfio_internal_handle_merge_staged_offsets_read(
+	          (libbfio_internal_handle_t *) handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "stage->number_of_offsets_read",
+	 stage->number_of_offsets_read,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The offset range read is tracked at the offset that was read
+	 */
+	result = libbfio_handle_get_offset_read(
+	          handle,
+	          1,
+	          &offset,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 512 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 88 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test more reads than can be staged, the reads within or adjacent
+	 * to the 2 offset ranges already read are merged into them
+	 */
+	for( offset = 0;
+	     offset < 600;
+	     offset += 2 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              1,
+		              offset,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "stage->number_of_offsets_read",
+	 stage->number_of_offsets_read,
+	 0 );
+
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          &number_of_offsets_read,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_offsets_read",
+	 number_of_offsets_read,
+	 225 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "stage->number_of_offsets_read",
+	 stage->number_of_offsets_read,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_handle_merge_staged_offsets_read(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_handle_get_number_of_extents and libbfio_handle_get_extent_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_extent_by_index(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	size64_t extent_size     = 0;
+	size64_t size            = 0;
+	size64_t total_size      = 0;
+	off64_t extent_offset    = 0;
+	uint32_t extent_flags    = 0;
+	int extent_index         = 0;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_number_of_extents(
+	          handle,
+	          &number_of_extents,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The extents should be contiguous and cover the entire data
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		result = libbfio_handle_get_extent_by_index(
+		          handle,
+		          extent_index,
+		          &extent_offset,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "extent_offset",
+		 (uint64_t) extent_offset,
+		 (uint64_t) total_size );
+
+		total_size += extent_size;
+	}
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "total_size",
+	 (uint64_t) total_size,
+	 (uint64_t) size );
+
+	if( size > 0 )
+	{
+		result = libbfio_handle_get_extent_at_offset(
+		          handle,
+		          (off64_t) ( size - 1 ),
+		          &extent_offset,
+		          &extent_size,
+		          &extent_flags,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		BFIO_TEST_ASSERT_EQUAL_UINT64(
+		 "extent_end_offset",
+		 (uint64_t) extent_offset + extent_size,
+		 (uint64_t) size );
+	}
+	result = libbfio_handle_get_extent_at_offset(
+	          handle,
+	          (off64_t) size,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_extent_by_index(
+	          handle,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_extent_by_index(
+	          handle,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_extent_at_offset(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &extent_flags,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_sparse_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_sparse_read(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ 64 ];
+	uint8_t sparse_buffer[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_get_size(
+	          handle,
+	          &size,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_size = 64;
+
+	if( size < (size64_t) read_size )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_sparse_read(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libbfio_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sparse read continues across extent boundaries
+	 */
+	while( buffer_offset < read_size )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              handle,
+		              &( sparse_buffer[ buffer_offset ] ),
+		              read_size - buffer_offset,
+		              &error );
+
+		BFIO_TEST_ASSERT_GREATER_THAN_INT(
+		 "read_count",
+		 (int) read_count,
+		 0 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		buffer_offset += (size_t) read_count;
+	}
+	result = memory_compare(
+	          sparse_buffer,
+	          buffer,
+	          read_size );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_set_sparse_read(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_sparse_read(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_handle_set_sparse_read(
+	 handle,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Retrieves test extents of which the second block of 256 bytes is sparse
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_handle_get_sparse_extents(
+     intptr_t *io_handle BFIO_TEST_ATTRIBUTE_UNUSED,
+     libcdata_array_t *extents_array,
+     libcerror_error_t **error )
+{
+	BFIO_TEST_UNREFERENCED_PARAMETER( io_handle )
+
+	if( libbfio_extent_append_to_array(
+	     extents_array,
+	     0,
+	     256,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_extent_append_to_array(
+	     extents_array,
+	     256,
+	     256,
+	     LIBBFIO_EXTENT_FLAG_IS_SPARSE,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_extent_append_to_array(
+	     extents_array,
+	     512,
+	     512,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests a sparse read that spans multiple extents
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_sparse_read_extents(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	size_t buffer_offset     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     bfio_test_handle_tracked_data,
+	     0xff,
+	     1024 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          bfio_test_handle_tracked_data,
+	          1024,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_get_extents_function(
+	          handle,
+	          &bfio_test_handle_get_sparse_extents,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_sparse_read(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              1024,
+	              128,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 896 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 896;
+	     buffer_offset++ )
+	{
+		if( ( buffer_offset >= 128 )
+		 && ( buffer_offset < 384 ) )
+		{
+			BFIO_TEST_ASSERT_EQUAL_UINT8(
+			 "buffer[ buffer_offset ]",
+			 buffer[ buffer_offset ],
+			 (uint8_t) 0x00 );
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_UINT8(
+			 "buffer[ buffer_offset ]",
+			 buffer[ buffer_offset ],
+			 (uint8_t) 0xff );
+		}
+	}
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* Tests the libbfio_handle_set_error_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_error_mode(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int error_code           = 0;
+	int error_domain         = 0;
+	int error_mode           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_get_error_mode(
+	          handle,
+	          &error_mode,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_mode",
+	 error_mode,
+	 LIBBFIO_ERROR_MODE_DEFAULT );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_error_mode(
+	          handle,
+	          LIBBFIO_ERROR_MODE_LIGHTWEIGHT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_error_mode(
+	          handle,
+	          &error_mode,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_mode",
+	 error_mode,
+	 LIBBFIO_ERROR_MODE_LIGHTWEIGHT );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A failed read in lightweight error mode only records the error domain and code
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_last_error(
+	          handle,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 LIBCERROR_ERROR_DOMAIN_IO );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBCERROR_IO_ERROR_SEEK_FAILED );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A successful read clears the last error
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "read_count",
+	 (int) read_count,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_last_error(
+	          handle,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_set_error_mode(
+	          handle,
+	          LIBBFIO_ERROR_MODE_DEFAULT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A failed read in default error mode sets the error
+	 */
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_get_error_mode(
+	          NULL,
+	          &error_mode,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_error_mode(
+	          handle,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_error_mode(
+	          NULL,
+	          LIBBFIO_ERROR_MODE_LIGHTWEIGHT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_error_mode(
+	          handle,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_last_error(
+	          NULL,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_last_error(
+	          handle,
+	          NULL,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_last_error(
+	          handle,
+	          &error_domain,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_handle_set_error_mode(
+	 handle,
+	 LIBBFIO_ERROR_MODE_DEFAULT,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_get_lock_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_get_lock_statistics(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error           = NULL;
+	uint64_t maximum_wait_time         = 0;
+	uint64_t number_of_contended_grabs = 0;
+	uint64_t number_of_grabs           = 0;
+	uint64_t total_wait_time           = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_track_lock_statistics(
+	          handle,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_is_open(
+	          handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_lock_statistics(
+	          handle,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+#if defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#else
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "number_of_grabs",
+	 (int64_t) number_of_grabs,
+	 (int64_t) 0 );
+#endif
+
+	result = libbfio_handle_set_track_lock_statistics(
+	          handle,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_track_lock_statistics(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_lock_statistics(
+	          NULL,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+	result = libbfio_handle_get_lock_statistics(
+	          handle,
+	          NULL,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_get_lock_statistics(
+	          handle,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_handle_set_track_lock_statistics(
+	 handle,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Counts the calls of the trace pre callback
+ */
+void bfio_test_handle_trace_pre_callback(
+      intptr_t *callback_data,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size )
+{
+	int *trace_values = (int *) callback_data;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( operation )
+	BFIO_TEST_UNREFERENCED_PARAMETER( entry )
+	BFIO_TEST_UNREFERENCED_PARAMETER( offset )
+	BFIO_TEST_UNREFERENCED_PARAMETER( size )
+
+	trace_values[ 0 ] += 1;
+}
+
+/* Counts the calls of the trace post callback and records the last operation and entry
+ */
+void bfio_test_handle_trace_post_callback(
+      intptr_t *callback_data,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size,
+      int64_t result,
+      uint64_t duration )
+{
+	int *trace_values = (int *) callback_data;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( offset )
+	BFIO_TEST_UNREFERENCED_PARAMETER( size )
+	BFIO_TEST_UNREFERENCED_PARAMETER( result )
+	BFIO_TEST_UNREFERENCED_PARAMETER( duration )
+
+	trace_values[ 1 ] += 1;
+	trace_values[ 2 ]  = operation;
+	trace_values[ 3 ]  = entry;
+}
+
+/* Tests the libbfio_handle_set_trace_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_trace_callbacks(
+     libbfio_handle_t *handle )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int trace_values[ 4 ]    = { 0, 0, 0, 0 };
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_set_trace_callbacks(
+	          handle,
+	          &bfio_test_handle_trace_pre_callback,
+	          &bfio_test_handle_trace_post_callback,
+	          (intptr_t *) trace_values,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "trace_values[ 0 ]",
+	 trace_values[ 0 ],
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 1 ]",
+	 trace_values[ 1 ],
+	 trace_values[ 0 ] );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 2 ]",
+	 trace_values[ 2 ],
+	 LIBBFIO_TRACE_OPERATION_READ );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 3 ]",
+	 trace_values[ 3 ],
+	 -1 );
+
+	result = libbfio_handle_set_trace_callbacks(
+	          handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	trace_values[ 0 ] = 0;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 0 ]",
+	 trace_values[ 0 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_trace_callbacks(
+	          NULL,
+	          &bfio_test_handle_trace_pre_callback,
+	          &bfio_test_handle_trace_post_callback,
+	          (intptr_t *) trace_values,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_handle_set_trace_callbacks(
+	 handle,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_prefetch function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_prefetch(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_handle_prefetch(
+	          handle,
+	          0,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_prefetch(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_prefetch(
+	          handle,
+	          -1,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_access_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_access_hint(
+     libbfio_handle_t *handle )
+{
+	libcerror_error_t *error = NULL;
+	int access_hint          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( access_hint = LIBBFIO_ACCESS_HINT_NORMAL;
+	     access_hint <= LIBBFIO_ACCESS_HINT_DONTNEED;
+	     access_hint++ )
+	{
+		result = libbfio_handle_set_access_hint(
+		          handle,
+		          access_hint,
+		          0,
+		          0,
+		          &error );
+
+		BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Restore the default access hint
+	 */
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_handle_set_access_hint(
+	          NULL,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          -1,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_handle_set_access_hint(
+	          handle,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          -1,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_handle_set_track_offsets_read function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_handle_set_track_offsets_read(
+     void )
+{
+	libbfio_handle_t *handle = NULL;
+	libcerror_error_t *error = NULL;
+	int number_of_offsets    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_handle_initialize(
+	          &handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
 	 handle );
 
 	BFIO_TEST_ASSERT_IS_NULL(
@@ -5776,6 +9178,29 @@ int bfio_test_handle_set_track_offsets_read(
 
 	/* Test regular cases
 	 */
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "offsets_read",
+	 ( (libbfio_internal_handle_t *) handle )->offsets_read );
+
+	result = libbfio_handle_get_number_of_offsets_read(
+	          handle,
+	          &number_of_offsets,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_offsets",
+	 number_of_offsets,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libbfio_handle_set_track_offsets_read(
 	          handle,
 	          1,
@@ -5790,6 +9215,10 @@ int bfio_test_handle_set_track_offsets_read(
 	 "error",
 	 error );
 
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "offsets_read",
+	 ( (libbfio_internal_handle_t *) handle )->offsets_read );
+
 	/* Test error cases
 	 */
 	result = libbfio_handle_set_track_offsets_read(
@@ -5946,6 +9375,10 @@ int main(
 	 "libbfio_handle_initialize",
 	 bfio_test_handle_initialize );
 
+	BFIO_TEST_RUN(
+	 "libbfio_handle_initialize_with_operations",
+	 bfio_test_handle_initialize_with_operations );
+
 	BFIO_TEST_RUN(
 	 "libbfio_handle_free",
 	 bfio_test_handle_free );
@@ -5982,6 +9415,50 @@ int main(
 	 "libbfio_handle_set_track_offsets_read",
 	 bfio_test_handle_set_track_offsets_read );
 
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_offsets_read_block_size",
+	 bfio_test_handle_set_offsets_read_block_size );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_get_offsets_read",
+	 bfio_test_handle_get_offsets_read );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_get_offsets_not_read",
+	 bfio_test_handle_get_offsets_not_read );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_get_offsets_read_heatmap",
+	 bfio_test_handle_get_offsets_read_heatmap );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_offsets_read_tracking_mode",
+	 bfio_test_handle_set_offsets_read_tracking_mode );
+
+	BFIO_TEST_RUN(
+	 "libbfio_handle_set_offsets_read_sampling_interval",
+	 bfio_test_handle_set_offsets_read_sampling_interval );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+	BFIO_TEST_RUN(
+	 "libbfio_internal_handle_read_buffer with sparse extents",
+	 bfio_test_handle_sparse_read_extents );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+	BFIO_TEST_RUN(
+	 "libbfio_internal_handle_merge_staged_offsets_read",
+	 bfio_test_internal_handle_merge_staged_offsets_read );
+
+	BFIO_TEST_RUN(
+	 "libbfio_internal_handle_close_if_open",
+	 bfio_test_internal_handle_close_if_open );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -6106,6 +9583,41 @@ int main(
 		 bfio_test_handle_get_offset_read,
 		 handle );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_get_extent_by_index",
+		 bfio_test_handle_get_extent_by_index,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_set_sparse_read",
+		 bfio_test_handle_set_sparse_read,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_set_error_mode",
+		 bfio_test_handle_set_error_mode,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_get_lock_statistics",
+		 bfio_test_handle_get_lock_statistics,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_set_trace_callbacks",
+		 bfio_test_handle_set_trace_callbacks,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_prefetch",
+		 bfio_test_handle_prefetch,
+		 handle );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_handle_set_access_hint",
+		 bfio_test_handle_set_access_hint,
+		 handle );
+
 		/* Clean up
 		 */
 		result = bfio_test_handle_close_source(
@@ -0,0 +1,1520 @@
+/*
+ * Library lock type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_rwlock.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_lock.h"
+
+/* Define to make bfio_test_lock print the elapsed time of the contention test,
+ * which compares the spin then park lock with the libcthreads read/write lock
+#define BFIO_TEST_LOCK_BENCHMARK
+ */
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define HAVE_BFIO_TEST_LOCK_CONTENTION	1
+#endif
+
+/* The number of threads and iterations of the contention test
+ */
+#define BFIO_TEST_LOCK_NUMBER_OF_THREADS	4
+#define BFIO_TEST_LOCK_NUMBER_OF_ITERATIONS	100000
+
+/* Every n-th iteration of the contention test grabs the lock for writing
+ */
+#define BFIO_TEST_LOCK_WRITE_INTERVAL		4
+
+typedef struct bfio_test_lock_contention_values bfio_test_lock_contention_values_t;
+
+struct bfio_test_lock_contention_values
+{
+	/* The lock
+	 */
+	libbfio_lock_t *lock;
+
+	/* The value protected by the lock
+	 */
+	int value;
+
+	/* The number of failed lock operations
+	 */
+	int number_of_failures;
+};
+
+typedef struct bfio_test_lock_writer_preference_values bfio_test_lock_writer_preference_values_t;
+
+struct bfio_test_lock_writer_preference_values
+{
+	/* The lock
+	 */
+	libbfio_lock_t *lock;
+
+	/* The value protected by the lock, which is set by the writer
+	 */
+	int value;
+
+	/* The value observed by the reader
+	 */
+	int observed_value;
+
+	/* Value to indicate the reader has grabbed the lock
+	 */
+	int reader_is_done;
+};
+
+/* The maximum number of times to yield while waiting for a test thread
+ */
+#define BFIO_TEST_LOCK_MAXIMUM_NUMBER_OF_YIELDS	10000000
+
+/* Tests the libbfio_lock_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_lock_initialize(
+     void )
+{
+	libbfio_lock_t *lock     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_lock_initialize(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "lock",
+	 lock );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_free(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "lock",
+	 lock );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_lock_initialize(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	lock = (libbfio_lock_t *) 0x12345678UL;
+
+	result = libbfio_lock_initialize(
+	          &lock,
+	          &error );
+
+	lock = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	/* Test libbfio_lock_initialize with malloc failing
+	 */
+	bfio_test_malloc_attempts_before_fail = 0;
+
+	result = libbfio_lock_initialize(
+	          &lock,
+	          &error );
+
+	if( bfio_test_malloc_attempts_before_fail != -1 )
+	{
+		bfio_test_malloc_attempts_before_fail = -1;
+
+		if( lock != NULL )
+		{
+			libbfio_lock_free(
+			 &lock,
+			 NULL );
+		}
+	}
+	else
+	{
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "lock",
+		 lock );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock != NULL )
+	{
+		libbfio_lock_free(
+		 &lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_lock_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_lock_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_lock_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_lock_initialize_embedded and libbfio_lock_finalize_embedded functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_lock_initialize_embedded(
+     void )
+{
+	libbfio_lock_t lock;
+
+	libcerror_error_t *error = NULL;
+	int is_initialized       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_lock_initialize_embedded(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	is_initialized = 1;
+
+	result = libbfio_lock_grab_for_write(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_release_for_write(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_finalize_embedded(
+	          &lock,
+	          &error );
+
+	is_initialized = 0;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_lock_initialize_embedded(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_finalize_embedded(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( is_initialized != 0 )
+	{
+		libbfio_lock_finalize_embedded(
+		 &lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_lock_grab_for_read, libbfio_lock_grab_for_write,
+ * libbfio_lock_release_for_read, libbfio_lock_release_for_write,
+ * libbfio_lock_set_track_statistics and libbfio_lock_get_statistics functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_lock_grab_and_release(
+     int lock_type )
+{
+	libbfio_lock_t *lock               = NULL;
+	libcerror_error_t *error           = NULL;
+	uint64_t maximum_wait_time         = 0;
+	uint64_t number_of_contended_grabs = 0;
+	uint64_t number_of_grabs           = 0;
+	uint64_t total_wait_time           = 0;
+	int default_lock_type              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_lock_get_default_type(
+	          &default_lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_set_default_type(
+	          lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_initialize(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "lock",
+	 lock );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "lock->lock_type",
+	 lock->lock_type,
+	 lock_type );
+
+	result = libbfio_lock_set_track_statistics(
+	          lock,
+	          1,
+	          &error );
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#else
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	libcerror_error_free(
+	 &error );
+#endif
+
+	/* Test regular cases
+	 */
+	result = libbfio_lock_grab_for_read(
+	          lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_grab_for_read(
+	          lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_release_for_read(
+	          lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_release_for_read(
+	          lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_grab_for_write(
+	          lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_release_for_write(
+	          lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_get_statistics(
+	          lock,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_grabs",
+	 number_of_grabs,
+	 (uint64_t) 3 );
+#endif
+
+	/* Test error cases
+	 */
+	result = libbfio_lock_grab_for_read(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_grab_for_write(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_release_for_read(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_release_for_write(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_set_track_statistics(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_get_statistics(
+	          NULL,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_lock_get_statistics(
+	          lock,
+	          NULL,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK )
+	{
+		/* Test releasing a lock that is not held
+		 */
+		result = libbfio_lock_release_for_read(
+		          lock,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libbfio_lock_release_for_write(
+		          lock,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_BFIO_TEST_RWLOCK_HOOK )
+	if( lock_type == LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK )
+	{
+		/* Test libbfio_lock_grab_for_read with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+		 */
+		bfio_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+		result = libbfio_lock_grab_for_read(
+		          lock,
+		          &error );
+
+		if( bfio_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+		{
+			bfio_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+
+			if( result == 1 )
+			{
+				libbfio_lock_release_for_read(
+				 lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		/* Test libbfio_lock_grab_for_write with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+		 */
+		bfio_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+		result = libbfio_lock_grab_for_write(
+		          lock,
+		          &error );
+
+		if( bfio_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+		{
+			bfio_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+
+			if( result == 1 )
+			{
+				libbfio_lock_release_for_write(
+				 lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libbfio_lock_free(
+	          &lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "lock",
+	 lock );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_set_default_type(
+	          default_lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock != NULL )
+	{
+		libbfio_lock_free(
+		 &lock,
+		 NULL );
+	}
+	libbfio_lock_set_default_type(
+	 default_lock_type,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( HAVE_BFIO_TEST_LOCK_CONTENTION )
+
+/* Grabs and releases the lock from a contention test thread
+ * Returns NULL
+ */
+void *bfio_test_lock_contention_thread(
+       void *arguments )
+{
+	bfio_test_lock_contention_values_t *contention_values = NULL;
+	int iteration                                          = 0;
+	int value                                              = 0;
+
+	contention_values = (bfio_test_lock_contention_values_t *) arguments;
+
+	for( iteration = 0;
+	     iteration < BFIO_TEST_LOCK_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		if( ( iteration % BFIO_TEST_LOCK_WRITE_INTERVAL ) == 0 )
+		{
+			if( libbfio_lock_grab_for_write(
+			     contention_values->lock,
+			     NULL ) != 1 )
+			{
+				__atomic_add_fetch(
+				 &( contention_values->number_of_failures ),
+				 1,
+				 __ATOMIC_SEQ_CST );
+
+				continue;
+			}
+			contention_values->value += 1;
+
+			if( libbfio_lock_release_for_write(
+			     contention_values->lock,
+			     NULL ) != 1 )
+			{
+				__atomic_add_fetch(
+				 &( contention_values->number_of_failures ),
+				 1,
+				 __ATOMIC_SEQ_CST );
+			}
+		}
+		else
+		{
+			if( libbfio_lock_grab_for_read(
+			     contention_values->lock,
+			     NULL ) != 1 )
+			{
+				__atomic_add_fetch(
+				 &( contention_values->number_of_failures ),
+				 1,
+				 __ATOMIC_SEQ_CST );
+
+				continue;
+			}
+			value = contention_values->value;
+
+			if( libbfio_lock_release_for_read(
+			     contention_values->lock,
+			     NULL ) != 1 )
+			{
+				__atomic_add_fetch(
+				 &( contention_values->number_of_failures ),
+				 1,
+				 __ATOMIC_SEQ_CST );
+			}
+		}
+	}
+	BFIO_TEST_UNREFERENCED_PARAMETER( value )
+
+	return( NULL );
+}
+
+/* Tests the lock under contention
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_lock_contention(
+     int lock_type )
+{
+	bfio_test_lock_contention_values_t contention_values;
+
+	pthread_t threads[ BFIO_TEST_LOCK_NUMBER_OF_THREADS ];
+
+#if defined( BFIO_TEST_LOCK_BENCHMARK ) && defined( CLOCK_MONOTONIC )
+	struct timespec end_time;
+	struct timespec start_time;
+
+	uint64_t elapsed_time    = 0;
+#endif
+	libcerror_error_t *error = NULL;
+	int default_lock_type    = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+	int thread_index         = 0;
+
+	contention_values.lock               = NULL;
+	contention_values.value              = 0;
+	contention_values.number_of_failures = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_lock_get_default_type(
+	          &default_lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_set_default_type(
+	          lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_initialize(
+	          &( contention_values.lock ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#if defined( BFIO_TEST_LOCK_BENCHMARK ) && defined( CLOCK_MONOTONIC )
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &start_time );
+#endif
+	for( thread_index = 0;
+	     thread_index < BFIO_TEST_LOCK_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = pthread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          &bfio_test_lock_contention_thread,
+		          &contention_values );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		number_of_threads++;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	number_of_threads = 0;
+
+#if defined( BFIO_TEST_LOCK_BENCHMARK ) && defined( CLOCK_MONOTONIC )
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &end_time );
+
+	elapsed_time = ( (uint64_t) ( end_time.tv_sec - start_time.tv_sec ) * 1000000000UL )
+	             + (uint64_t) end_time.tv_nsec - (uint64_t) start_time.tv_nsec;
+
+	fprintf(
+	 stdout,
+	 "Lock contention (%s, %d threads, %d iterations): %" PRIu64 " us\n",
+	 ( lock_type == LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK ) ? "spin then park" : "libcthreads read/write lock",
+	 BFIO_TEST_LOCK_NUMBER_OF_THREADS,
+	 BFIO_TEST_LOCK_NUMBER_OF_ITERATIONS,
+	 elapsed_time / 1000 );
+#endif
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "contention_values.number_of_failures",
+	 contention_values.number_of_failures,
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "contention_values.value",
+	 contention_values.value,
+	 BFIO_TEST_LOCK_NUMBER_OF_THREADS * ( BFIO_TEST_LOCK_NUMBER_OF_ITERATIONS / BFIO_TEST_LOCK_WRITE_INTERVAL ) );
+
+	/* Clean up
+	 */
+	result = libbfio_lock_free(
+	          &( contention_values.lock ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_set_default_type(
+	          default_lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_join(
+		 threads[ thread_index ],
+		 NULL );
+	}
+	if( contention_values.lock != NULL )
+	{
+		libbfio_lock_free(
+		 &( contention_values.lock ),
+		 NULL );
+	}
+	libbfio_lock_set_default_type(
+	 default_lock_type,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+
+/* Grabs the lock for writing and sets the value from a writer preference test thread
+ * Returns NULL
+ */
+void *bfio_test_lock_writer_preference_writer_thread(
+       void *arguments )
+{
+	bfio_test_lock_writer_preference_values_t *writer_preference_values = NULL;
+
+	writer_preference_values = (bfio_test_lock_writer_preference_values_t *) arguments;
+
+	if( libbfio_lock_grab_for_write(
+	     writer_preference_values->lock,
+	     NULL ) == 1 )
+	{
+		writer_preference_values->value = 1;
+
+		libbfio_lock_release_for_write(
+		 writer_preference_values->lock,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Grabs the lock for reading and observes the value from a writer preference test thread
+ * Returns NULL
+ */
+void *bfio_test_lock_writer_preference_reader_thread(
+       void *arguments )
+{
+	bfio_test_lock_writer_preference_values_t *writer_preference_values = NULL;
+
+	writer_preference_values = (bfio_test_lock_writer_preference_values_t *) arguments;
+
+	if( libbfio_lock_grab_for_read(
+	     writer_preference_values->lock,
+	     NULL ) == 1 )
+	{
+		writer_preference_values->observed_value = writer_preference_values->value;
+
+		libbfio_lock_release_for_read(
+		 writer_preference_values->lock,
+		 NULL );
+	}
+	__atomic_store_n(
+	 &( writer_preference_values->reader_is_done ),
+	 1,
+	 __ATOMIC_SEQ_CST );
+
+	return( NULL );
+}
+
+/* Tests that the spin then park lock prefers a waiting writer over a new reader
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_lock_writer_preference(
+     void )
+{
+	bfio_test_lock_writer_preference_values_t writer_preference_values;
+
+	pthread_t reader_thread;
+	pthread_t writer_thread;
+
+	libcerror_error_t *error = NULL;
+	int default_lock_type    = 0;
+	int has_read_lock        = 0;
+	int has_reader_thread    = 0;
+	int has_writer_thread    = 0;
+	int number_of_yields     = 0;
+	int result               = 0;
+
+	writer_preference_values.lock           = NULL;
+	writer_preference_values.value          = 0;
+	writer_preference_values.observed_value = -1;
+	writer_preference_values.reader_is_done = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_lock_get_default_type(
+	          &default_lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_set_default_type(
+	          LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_initialize(
+	          &( writer_preference_values.lock ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_lock_grab_for_read(
+	          writer_preference_values.lock,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	has_read_lock = 1;
+
+	result = pthread_create(
+	          &writer_thread,
+	          NULL,
+	          &bfio_test_lock_writer_preference_writer_thread,
+	          &writer_preference_values );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	has_writer_thread = 1;
+
+	/* Wait for the writer to register itself as waiting
+	 */
+	for( number_of_yields = 0;
+	     number_of_yields < BFIO_TEST_LOCK_MAXIMUM_NUMBER_OF_YIELDS;
+	     number_of_yields++ )
+	{
+		if( __atomic_load_n(
+		     &( writer_preference_values.lock->number_of_waiting_writers ),
+		     __ATOMIC_SEQ_CST ) != 0 )
+		{
+			break;
+		}
+		sched_yield();
+	}
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_waiting_writers",
+	 (int) writer_preference_values.lock->number_of_waiting_writers,
+	 0 );
+
+	result = pthread_create(
+	          &reader_thread,
+	          NULL,
+	          &bfio_test_lock_writer_preference_reader_thread,
+	          &writer_preference_values );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	has_reader_thread = 1;
+
+	/* Wait for both the writer and the reader to be parked, without writer
+	 * preference the reader grabs the lock while it is held for reading
+	 */
+	for( number_of_yields = 0;
+	     number_of_yields < BFIO_TEST_LOCK_MAXIMUM_NUMBER_OF_YIELDS;
+	     number_of_yields++ )
+	{
+		if( ( __atomic_load_n(
+		       &( writer_preference_values.reader_is_done ),
+		       __ATOMIC_SEQ_CST ) != 0 )
+		 || ( __atomic_load_n(
+		       &( writer_preference_values.lock->number_of_parked_threads ),
+		       __ATOMIC_SEQ_CST ) >= 2 ) )
+		{
+			break;
+		}
+		sched_yield();
+	}
+	result = libbfio_lock_release_for_read(
+	          writer_preference_values.lock,
+	          &error );
+
+	has_read_lock = 0;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	pthread_join(
+	 writer_thread,
+	 NULL );
+
+	has_writer_thread = 0;
+
+	pthread_join(
+	 reader_thread,
+	 NULL );
+
+	has_reader_thread = 0;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "writer_preference_values.observed_value",
+	 writer_preference_values.observed_value,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libbfio_lock_free(
+	          &( writer_preference_values.lock ),
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_lock_set_default_type(
+	          default_lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( has_read_lock != 0 )
+	{
+		libbfio_lock_release_for_read(
+		 writer_preference_values.lock,
+		 NULL );
+	}
+	if( has_writer_thread != 0 )
+	{
+		pthread_join(
+		 writer_thread,
+		 NULL );
+	}
+	if( has_reader_thread != 0 )
+	{
+		pthread_join(
+		 reader_thread,
+		 NULL );
+	}
+	if( writer_preference_values.lock != NULL )
+	{
+		libbfio_lock_free(
+		 &( writer_preference_values.lock ),
+		 NULL );
+	}
+	libbfio_lock_set_default_type(
+	 default_lock_type,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBBFIO_SPIN_LOCK ) */
+
+#endif /* defined( HAVE_BFIO_TEST_LOCK_CONTENTION ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	BFIO_TEST_UNREFERENCED_PARAMETER( argc )
+	BFIO_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+
+	BFIO_TEST_RUN(
+	 "libbfio_lock_initialize",
+	 bfio_test_lock_initialize );
+
+	BFIO_TEST_RUN(
+	 "libbfio_lock_free",
+	 bfio_test_lock_free );
+
+	BFIO_TEST_RUN(
+	 "libbfio_lock_initialize_embedded",
+	 bfio_test_lock_initialize_embedded );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_lock_grab_for_read",
+	 bfio_test_lock_grab_and_release,
+	 LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK );
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_lock_grab_for_read",
+	 bfio_test_lock_grab_and_release,
+	 LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK );
+
+#endif /* defined( HAVE_LIBBFIO_SPIN_LOCK ) */
+
+#if defined( HAVE_BFIO_TEST_LOCK_CONTENTION )
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_lock_grab_for_write",
+	 bfio_test_lock_contention,
+	 LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK );
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_lock_grab_for_write",
+	 bfio_test_lock_contention,
+	 LIBBFIO_LOCK_TYPE_SPIN_THEN_PARK );
+
+	BFIO_TEST_RUN(
+	 "libbfio_lock_grab_for_write",
+	 bfio_test_lock_writer_preference );
+
+#endif /* defined( HAVE_LIBBFIO_SPIN_LOCK ) */
+
+#endif /* defined( HAVE_BFIO_TEST_LOCK_CONTENTION ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
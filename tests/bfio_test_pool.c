@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -40,7 +41,9 @@
 #include "bfio_test_macros.h"
 #include "bfio_test_memory.h"
 #include "bfio_test_rwlock.h"
+#include "bfio_test_unused.h"
 
+#include "../libbfio/libbfio_file.h"
 #include "../libbfio/libbfio_pool.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -488,6 +491,135 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbfio_pool_initialize_with_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_initialize_with_arena(
+     void )
+{
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_initialize_with_arena(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_initialize_with_arena(
+	          NULL,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pool = (libbfio_pool_t *) 0x12345678UL;
+
+	result = libbfio_pool_initialize_with_arena(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	pool = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_initialize_with_arena(
+	          &pool,
+	          -1,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libbfio_pool_free function
  * Returns 1 if successful or 0 if not
  */
@@ -1257,6 +1389,7 @@ int bfio_test_internal_pool_open_handle(
 	 */
 	result = libbfio_internal_pool_open_handle(
 	          (libbfio_internal_pool_t *) pool,
+	          -1,
 	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -1272,6 +1405,7 @@ int bfio_test_internal_pool_open_handle(
 
 	result = libbfio_internal_pool_open_handle(
 	          (libbfio_internal_pool_t *) pool,
+	          -1,
 	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -1291,6 +1425,7 @@ int bfio_test_internal_pool_open_handle(
 	 */
 	result = libbfio_internal_pool_open_handle(
 	          NULL,
+	          -1,
 	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -1313,6 +1448,7 @@ int bfio_test_internal_pool_open_handle(
 
 	result = libbfio_internal_pool_open_handle(
 	          (libbfio_internal_pool_t *) pool,
+	          -1,
 	          test_handle,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -1333,6 +1469,7 @@ int bfio_test_internal_pool_open_handle(
 
 	result = libbfio_internal_pool_open_handle(
 	          (libbfio_internal_pool_t *) pool,
+	          -1,
 	          NULL,
 	          LIBBFIO_OPEN_READ,
 	          &error );
@@ -2437,15 +2574,2934 @@ int bfio_test_pool_set_maximum_number_of_open_handles(
 		 result,
 		 -1 );
 
-		BFIO_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+		BFIO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
+#endif /* defined( HAVE_BFIO_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_set_adaptive_maximum_number_of_open_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_adaptive_maximum_number_of_open_handles(
+     void )
+{
+	uint8_t buffer[ 4 ];
+	uint8_t data[ 16 ]                               = {
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libbfio_handle_t *handle                         = NULL;
+	libbfio_pool_t *pool                             = NULL;
+	libcerror_error_t *error                         = NULL;
+	ssize_t read_count                               = 0;
+	int access_index                                 = 0;
+	int entry                                        = 0;
+	int handle_index                                 = 0;
+	int maximum_number_of_open_handles               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( handle_index = 0;
+	     handle_index < 16;
+	     handle_index++ )
+	{
+		result = libbfio_memory_range_initialize(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libbfio_memory_range_set(
+		          handle,
+		          data,
+		          16,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libbfio_pool_append_handle(
+		          pool,
+		          &entry,
+		          handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		handle = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_adaptive_maximum_number_of_open_handles(
+	          pool,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Accessing the entries round-robin reopens a handle on every access
+	 * which increases the maximum number of open handles
+	 */
+	for( access_index = 0;
+	     access_index < 512;
+	     access_index++ )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool,
+		              access_index % 16,
+		              buffer,
+		              4,
+		              0,
+		              &error );
+
+		BFIO_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libbfio_pool_get_maximum_number_of_open_handles(
+	          pool,
+	          &maximum_number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "maximum_number_of_open_handles",
+	 maximum_number_of_open_handles,
+	 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_adaptive_maximum_number_of_open_handles(
+	          pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_adaptive_maximum_number_of_open_handles(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test setting the adaptive maximum of a pool with a descriptor manager
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_set_descriptor_manager(
+	          pool,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_adaptive_maximum_number_of_open_handles(
+	          pool,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_get_eviction_policy and libbfio_pool_set_eviction_policy functions
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_eviction_policy(
+     void )
+{
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	int eviction_policy      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_get_eviction_policy(
+	          pool,
+	          &eviction_policy,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "eviction_policy",
+	 eviction_policy,
+	 LIBBFIO_POOL_EVICTION_POLICY_LRU );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_eviction_policy(
+	          pool,
+	          LIBBFIO_POOL_EVICTION_POLICY_LFU,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_eviction_policy(
+	          pool,
+	          &eviction_policy,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "eviction_policy",
+	 eviction_policy,
+	 LIBBFIO_POOL_EVICTION_POLICY_LFU );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_get_eviction_policy(
+	          NULL,
+	          &eviction_policy,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_eviction_policy(
+	          pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_eviction_policy(
+	          NULL,
+	          LIBBFIO_POOL_EVICTION_POLICY_LRU,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_eviction_policy(
+	          pool,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the handle closed by the LRU and LFU eviction policies
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_eviction_policy_lfu(
+     void )
+{
+	uint8_t buffer[ 4 ];
+	uint8_t data[ 16 ]              = {
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+	/* The entries accessed before the last entry is opened, where the first entry
+	 * is the most frequently used but not the most recently used
+	 */
+	int access_sequence[ 7 ]        = { 0, 1, 0, 1, 0, 2, 1 };
+
+	libbfio_handle_t *handle        = NULL;
+	libbfio_pool_t *pool            = NULL;
+	libcerror_error_t *error        = NULL;
+	ssize_t read_count              = 0;
+	int access_index                = 0;
+	int entry                       = 0;
+	int eviction_policy             = 0;
+	int expected_is_open            = 0;
+	int handle_index                = 0;
+	int result                      = 0;
+
+	for( eviction_policy = LIBBFIO_POOL_EVICTION_POLICY_LRU;
+	     eviction_policy <= LIBBFIO_POOL_EVICTION_POLICY_LFU;
+	     eviction_policy += LIBBFIO_POOL_EVICTION_POLICY_LFU )
+	{
+		/* Initialize test
+		 */
+		result = libbfio_pool_initialize(
+		          &pool,
+		          0,
+		          4,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_set_eviction_policy(
+		          pool,
+		          eviction_policy,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( handle_index = 0;
+		     handle_index < 4;
+		     handle_index++ )
+		{
+			result = libbfio_memory_range_initialize(
+			          &handle,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libbfio_memory_range_set(
+			          handle,
+			          data,
+			          16,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libbfio_pool_append_handle(
+			          pool,
+			          &entry,
+			          handle,
+			          LIBBFIO_OPEN_READ,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			handle = NULL;
+		}
+		/* Test regular cases
+		 */
+		for( access_index = 0;
+		     access_index < 8;
+		     access_index++ )
+		{
+			if( access_index < 7 )
+			{
+				entry = access_sequence[ access_index ];
+			}
+			else
+			{
+				entry = 3;
+			}
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              pool,
+			              entry,
+			              buffer,
+			              4,
+			              0,
+			              &error );
+
+			BFIO_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) 4 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* LRU closes the least recently used first entry,
+		 * LFU closes the least frequently used third entry
+		 */
+		result = libbfio_pool_get_handle(
+		          pool,
+		          0,
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_is_open(
+		          handle,
+		          &error );
+
+		handle = NULL;
+
+		if( eviction_policy == LIBBFIO_POOL_EVICTION_POLICY_LFU )
+		{
+			expected_is_open = 1;
+		}
+		else
+		{
+			expected_is_open = 0;
+		}
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_is_open );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_get_handle(
+		          pool,
+		          2,
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libbfio_handle_is_open(
+		          handle,
+		          &error );
+
+		handle = NULL;
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 - expected_is_open );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libbfio_pool_free(
+		          &pool,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_set_handle_pinned function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_handle_pinned(
+     void )
+{
+	uint8_t buffer[ 4 ];
+	uint8_t data[ 16 ]       = {
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+	libbfio_handle_t *handle = NULL;
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int access_index         = 0;
+	int entry                = 0;
+	int eviction_policy      = 0;
+	int handle_index         = 0;
+	int result               = 0;
+
+	for( eviction_policy = LIBBFIO_POOL_EVICTION_POLICY_LRU;
+	     eviction_policy <= LIBBFIO_POOL_EVICTION_POLICY_LFU;
+	     eviction_policy++ )
+	{
+		/* Initialize test
+		 */
+		result = libbfio_pool_initialize(
+		          &pool,
+		          0,
+		          3,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_set_eviction_policy(
+		          pool,
+		          eviction_policy,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( handle_index = 0;
+		     handle_index < 3;
+		     handle_index++ )
+		{
+			result = libbfio_memory_range_initialize(
+			          &handle,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libbfio_memory_range_set(
+			          handle,
+			          data,
+			          16,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			result = libbfio_pool_append_handle(
+			          pool,
+			          &entry,
+			          handle,
+			          LIBBFIO_OPEN_READ,
+			          &error );
+
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			handle = NULL;
+		}
+		/* Test regular cases
+		 */
+		result = libbfio_pool_set_handle_pinned(
+		          pool,
+		          0,
+		          1,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Access the entries so that the pinned first entry is
+		 * the least recently and least frequently used
+		 */
+		for( access_index = 0;
+		     access_index < 7;
+		     access_index++ )
+		{
+			if( access_index == 0 )
+			{
+				entry = 0;
+			}
+			else
+			{
+				entry = 1 + ( access_index % 2 );
+			}
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              pool,
+			              entry,
+			              buffer,
+			              4,
+			              0,
+			              &error );
+
+			BFIO_TEST_ASSERT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) 4 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libbfio_pool_get_handle(
+		          pool,
+		          0,
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libbfio_handle_is_open(
+		          handle,
+		          &error );
+
+		handle = NULL;
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_set_handle_pinned(
+		          pool,
+		          0,
+		          0,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libbfio_pool_free(
+		          &pool,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_handle_pinned(
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          3,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_set_handle_pinned(
+	          pool,
+	          -1,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_set_descriptor_manager function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_descriptor_manager(
+     void )
+{
+	uint8_t buffer[ 4 ];
+	uint8_t first_data[ 16 ]  = {
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+	uint8_t second_data[ 16 ] = {
+		'f', 'e', 'd', 'c', 'b', 'a', '9', '8', '7', '6', '5', '4', '3', '2', '1', '0' };
+
+	libbfio_descriptor_manager_t *descriptor_manager = NULL;
+	libbfio_handle_t *handle                         = NULL;
+	libbfio_pool_t *first_pool                       = NULL;
+	libbfio_pool_t *second_pool                      = NULL;
+	libcerror_error_t *error                         = NULL;
+	ssize_t read_count                               = 0;
+	int entry                                        = 0;
+	int number_of_open_handles                       = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_descriptor_manager_initialize(
+	          &descriptor_manager,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &first_pool,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_initialize(
+	          &second_pool,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_descriptor_manager(
+	          first_pool,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_descriptor_manager(
+	          second_pool,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          first_data,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_append_handle(
+	          first_pool,
+	          &entry,
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	handle = NULL;
+
+	result = libbfio_memory_range_initialize(
+	          &handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_set(
+	          handle,
+	          second_data,
+	          16,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_append_handle(
+	          second_pool,
+	          &entry,
+	          handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	handle = NULL;
+
+	/* Reading from the pools alternately keeps a single handle open
+	 */
+	read_count = libbfio_pool_read_buffer(
+	              first_pool,
+	              0,
+	              buffer,
+	              4,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_pool_read_buffer(
+	              second_pool,
+	              0,
+	              buffer,
+	              4,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The handle of the first pool is reopened at its current offset
+	 */
+	read_count = libbfio_pool_read_buffer(
+	              first_pool,
+	              0,
+	              buffer,
+	              4,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( first_data[ 4 ] ),
+	          4 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_descriptor_manager_get_number_of_open_handles(
+	          descriptor_manager,
+	          &number_of_open_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_open_handles",
+	 number_of_open_handles,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_descriptor_manager(
+	          NULL,
+	          descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test setting the descriptor manager of a pool that contains handles
+	 */
+	result = libbfio_pool_set_descriptor_manager(
+	          first_pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test setting the maximum number of open handles of a pool with a descriptor manager
+	 */
+	result = libbfio_pool_set_maximum_number_of_open_handles(
+	          first_pool,
+	          4,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &second_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_pool_free(
+	          &first_pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_descriptor_manager_free(
+	          &descriptor_manager,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "descriptor_manager",
+	 descriptor_manager );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( second_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &second_pool,
+		 NULL );
+	}
+	if( first_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &first_pool,
+		 NULL );
+	}
+	if( descriptor_manager != NULL )
+	{
+		libbfio_descriptor_manager_free(
+		 &descriptor_manager,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_pool_set_single_threaded_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_single_threaded_handles(
+     void )
+{
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_single_threaded_handles(
+	          pool,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "handle_flags",
+	 (int) ( ( (libbfio_internal_pool_t *) pool )->handle_flags & LIBBFIO_FLAG_SINGLE_THREADED ),
+	 LIBBFIO_FLAG_SINGLE_THREADED );
+
+	result = libbfio_pool_set_single_threaded_handles(
+	          pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "handle_flags",
+	 (int) ( ( (libbfio_internal_pool_t *) pool )->handle_flags & LIBBFIO_FLAG_SINGLE_THREADED ),
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_single_threaded_handles(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libbfio_internal_pool_pre_open_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_internal_pool_pre_open_handle(
+     const system_character_t *source )
+{
+	libbfio_handle_t *handle = NULL;
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	size_t source_length     = 0;
+	int entry                = 0;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = system_string_length(
+	                 source );
+
+	/* The second handle is single threaded and has no read/write lock
+	 */
+	for( entry = 0;
+	     entry < 2;
+	     entry++ )
+	{
+		result = libbfio_file_initialize_in_arena(
+		          &handle,
+		          NULL,
+		          ( entry == 0 ) ? 0 : LIBBFIO_FLAG_SINGLE_THREADED,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          handle,
+		          source,
+		          source_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          handle,
+		          source,
+		          source_length,
+		          &error );
+#endif
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          pool,
+		          &entry_index,
+		          handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		handle = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libbfio_internal_pool_pre_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pre_open_thread_pool",
+	 ( (libbfio_internal_pool_t *) pool )->pre_open_thread_pool );
+
+	result = libbfio_internal_pool_wait_for_pre_open(
+	          (libbfio_internal_pool_t *) pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A handle without a read/write lock is not pre-opened
+	 */
+	result = libbfio_internal_pool_pre_open_handle(
+	          (libbfio_internal_pool_t *) pool,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pre_open_handle",
+	 ( (libbfio_internal_pool_t *) pool )->pre_open_handle );
+
+	/* Test error cases
+	 */
+	result = libbfio_internal_pool_pre_open_handle(
+	          NULL,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libbfio_pool_set_pre_open_next_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_pre_open_next_entry(
+     const system_character_t *source )
+{
+	uint8_t buffer[ 32 ];
+
+	libbfio_handle_t *handle = NULL;
+	libbfio_pool_t *pool     = NULL;
+	libcerror_error_t *error = NULL;
+	size_t source_length     = 0;
+	ssize_t read_count       = 0;
+	int entry                = 0;
+	int entry_index          = 0;
+	int result               = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *pre_open_thread_pool = NULL;
+	libbfio_handle_t *next_handle                   = NULL;
+#endif
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &pool,
+	          0,
+	          3,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = system_string_length(
+	                 source );
+
+	for( entry = 0;
+	     entry < 4;
+	     entry++ )
+	{
+		result = libbfio_file_initialize(
+		          &handle,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          handle,
+		          source,
+		          source_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          handle,
+		          source,
+		          source_length,
+		          &error );
+#endif
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          pool,
+		          &entry_index,
+		          handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		BFIO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		handle = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_pre_open_next_entry(
+	          pool,
+	          1,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+
+	/* Accessing the first entry pre-opens the entry right after it
+	 */
+	result = libbfio_pool_get_handle(
+	          pool,
+	          1,
+	          &next_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "read_count",
+	 (int) read_count,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = (int) ( ( (libbfio_internal_pool_t *) pool )->pre_open_handle == next_handle );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "pre_open_handle == next_handle",
+	 result,
+	 1 );
+
+	pre_open_thread_pool = ( (libbfio_internal_pool_t *) pool )->pre_open_thread_pool;
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pre_open_thread_pool",
+	 pre_open_thread_pool );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Read the entries sequentially to trigger the pre-open
+	 */
+	for( entry = 0;
+	     entry < 4;
+	     entry++ )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool,
+		              entry,
+		              buffer,
+		              32,
+		              0,
+		              &error );
+
+		BFIO_TEST_ASSERT_GREATER_THAN_INT(
+		 "read_count",
+		 (int) read_count,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+
+	/* Prefetching data and setting an access hint wait for the pre-open thread
+	 */
+	for( entry = 0;
+	     entry < 2;
+	     entry++ )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              pool,
+		              entry,
+		              buffer,
+		              32,
+		              0,
+		              &error );
+
+		BFIO_TEST_ASSERT_GREATER_THAN_INT(
+		 "read_count",
+		 (int) read_count,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pre_open_handle",
+	 ( (libbfio_internal_pool_t *) pool )->pre_open_handle );
+
+	/* The same pre-open thread is used for every pre-open
+	 */
+	result = (int) ( ( (libbfio_internal_pool_t *) pool )->pre_open_thread_pool == pre_open_thread_pool );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "pre_open_thread_pool == previous pre_open_thread_pool",
+	 result,
+	 1 );
+
+	result = libbfio_pool_prefetch(
+	          pool,
+	          2,
+	          0,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pre_open_handle",
+	 ( (libbfio_internal_pool_t *) pool )->pre_open_handle );
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              2,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "read_count",
+	 (int) read_count,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "pre_open_handle",
+	 ( (libbfio_internal_pool_t *) pool )->pre_open_handle );
+
+	result = (int) ( ( (libbfio_internal_pool_t *) pool )->pre_open_thread_pool == pre_open_thread_pool );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "pre_open_thread_pool == previous pre_open_thread_pool",
+	 result,
+	 1 );
+
+	result = libbfio_pool_set_access_hint(
+	          pool,
+	          LIBBFIO_ACCESS_HINT_SEQUENTIAL,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pre_open_handle",
+	 ( (libbfio_internal_pool_t *) pool )->pre_open_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libbfio_pool_set_pre_open_next_entry(
+	          pool,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_pre_open_next_entry(
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_pre_open_next_entry(
+	          pool,
+	          1,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_close_all(
+	          pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &pool,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "pool",
+	 pool );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libbfio_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( pool != NULL )
+	{
+		libbfio_pool_free(
+		 &pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_set_error_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_error_mode(
+     libbfio_pool_t *pool )
+{
+	uint8_t buffer[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int error_code           = 0;
+	int error_domain         = 0;
+	int error_mode           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_get_error_mode(
+	          pool,
+	          &error_mode,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_mode",
+	 error_mode,
+	 LIBBFIO_ERROR_MODE_DEFAULT );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_error_mode(
+	          pool,
+	          LIBBFIO_ERROR_MODE_LIGHTWEIGHT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_error_mode(
+	          pool,
+	          &error_mode,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_mode",
+	 error_mode,
+	 LIBBFIO_ERROR_MODE_LIGHTWEIGHT );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A failed read in lightweight error mode only records the error domain and code
+	 */
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_last_error(
+	          pool,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 LIBCERROR_ERROR_DOMAIN_IO );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBCERROR_IO_ERROR_SEEK_FAILED );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              -1,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_last_error(
+	          pool,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A successful read clears the last error
+	 */
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_GREATER_THAN_INT(
+	 "read_count",
+	 (int) read_count,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_last_error(
+	          pool,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_set_error_mode(
+	          pool,
+	          LIBBFIO_ERROR_MODE_DEFAULT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A failed read in default error mode sets the error
+	 */
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              32,
+	              -1,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_get_error_mode(
+	          NULL,
+	          &error_mode,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_error_mode(
+	          pool,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_error_mode(
+	          NULL,
+	          LIBBFIO_ERROR_MODE_LIGHTWEIGHT,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_error_mode(
+	          pool,
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_last_error(
+	          NULL,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_last_error(
+	          pool,
+	          NULL,
+	          &error_code,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_last_error(
+	          pool,
+	          &error_domain,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_pool_set_error_mode(
+	 pool,
+	 LIBBFIO_ERROR_MODE_DEFAULT,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_get_lock_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_get_lock_statistics(
+     libbfio_pool_t *pool )
+{
+	libcerror_error_t *error           = NULL;
+	uint64_t maximum_wait_time         = 0;
+	uint64_t number_of_contended_grabs = 0;
+	uint64_t number_of_grabs           = 0;
+	uint64_t total_wait_time           = 0;
+	int number_of_handles              = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_track_lock_statistics(
+	          pool,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_number_of_handles(
+	          pool,
+	          &number_of_handles,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_get_lock_statistics(
+	          pool,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+#if defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+#else
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBBFIO_SPIN_LOCK )
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "number_of_grabs",
+	 (int64_t) number_of_grabs,
+	 (int64_t) 0 );
+#endif
+
+	result = libbfio_pool_set_track_lock_statistics(
+	          pool,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_track_lock_statistics(
+	          NULL,
+	          1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_lock_statistics(
+	          NULL,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+	result = libbfio_pool_get_lock_statistics(
+	          pool,
+	          NULL,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          &maximum_wait_time,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_get_lock_statistics(
+	          pool,
+	          &number_of_grabs,
+	          &number_of_contended_grabs,
+	          &total_wait_time,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libbfio_pool_set_track_lock_statistics(
+	 pool,
+	 0,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Counts the calls of the trace pre callback
+ */
+void bfio_test_pool_trace_pre_callback(
+      intptr_t *callback_data,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size )
+{
+	int *trace_values = (int *) callback_data;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( operation )
+	BFIO_TEST_UNREFERENCED_PARAMETER( entry )
+	BFIO_TEST_UNREFERENCED_PARAMETER( offset )
+	BFIO_TEST_UNREFERENCED_PARAMETER( size )
+
+	trace_values[ 0 ] += 1;
+}
+
+/* Counts the calls of the trace post callback and records the last operation and entry
+ */
+void bfio_test_pool_trace_post_callback(
+      intptr_t *callback_data,
+      int operation,
+      int entry,
+      off64_t offset,
+      size64_t size,
+      int64_t result,
+      uint64_t duration )
+{
+	int *trace_values = (int *) callback_data;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( offset )
+	BFIO_TEST_UNREFERENCED_PARAMETER( size )
+	BFIO_TEST_UNREFERENCED_PARAMETER( result )
+	BFIO_TEST_UNREFERENCED_PARAMETER( duration )
+
+	trace_values[ 1 ] += 1;
+	trace_values[ 2 ]  = operation;
+	trace_values[ 3 ]  = entry;
+}
+
+/* Tests the libbfio_pool_set_trace_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_trace_callbacks(
+     libbfio_pool_t *pool )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int trace_values[ 4 ]    = { 0, 0, 0, 0 };
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_set_trace_callbacks(
+	          pool,
+	          &bfio_test_pool_trace_pre_callback,
+	          &bfio_test_pool_trace_post_callback,
+	          (intptr_t *) trace_values,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "trace_values[ 0 ]",
+	 trace_values[ 0 ],
+	 0 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 1 ]",
+	 trace_values[ 1 ],
+	 trace_values[ 0 ] );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 2 ]",
+	 trace_values[ 2 ],
+	 LIBBFIO_TRACE_OPERATION_READ );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 3 ]",
+	 trace_values[ 3 ],
+	 0 );
+
+	result = libbfio_pool_set_trace_callbacks(
+	          pool,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	trace_values[ 0 ] = 0;
+
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              pool,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	BFIO_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "trace_values[ 0 ]",
+	 trace_values[ 0 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_trace_callbacks(
+	          NULL,
+	          &bfio_test_pool_trace_pre_callback,
+	          &bfio_test_pool_trace_post_callback,
+	          (intptr_t *) trace_values,
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_LOCAL_LIBCDATA ) */
-#endif /* defined( HAVE_BFIO_TEST_RWLOCK_HOOK ) */
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -2455,6 +5511,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libbfio_pool_set_trace_callbacks(
+	 pool,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
 	return( 0 );
 }
 
@@ -7300,6 +10363,223 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbfio_pool_prefetch function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_prefetch(
+     libbfio_pool_t *pool )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_pool_prefetch(
+	          pool,
+	          0,
+	          0,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_prefetch(
+	          NULL,
+	          0,
+	          0,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_prefetch(
+	          pool,
+	          -1,
+	          0,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_prefetch(
+	          pool,
+	          0,
+	          -1,
+	          4096,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_pool_set_access_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_pool_set_access_hint(
+     libbfio_pool_t *pool )
+{
+	libcerror_error_t *error = NULL;
+	int access_hint          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( access_hint = LIBBFIO_ACCESS_HINT_NORMAL;
+	     access_hint <= LIBBFIO_ACCESS_HINT_DONTNEED;
+	     access_hint++ )
+	{
+		result = libbfio_pool_set_access_hint(
+		          pool,
+		          access_hint,
+		          0,
+		          0,
+		          &error );
+
+		BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		BFIO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Restore the default access hint
+	 */
+	result = libbfio_pool_set_access_hint(
+	          pool,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_pool_set_access_hint(
+	          NULL,
+	          LIBBFIO_ACCESS_HINT_NORMAL,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_access_hint(
+	          pool,
+	          -1,
+	          0,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_pool_set_access_hint(
+	          pool,
+	          LIBBFIO_ACCESS_HINT_WILLNEED,
+	          -1,
+	          0,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -7351,6 +10631,10 @@ int main(
 	 "libbfio_pool_initialize",
 	 bfio_test_pool_initialize );
 
+	BFIO_TEST_RUN(
+	 "libbfio_pool_initialize_with_arena",
+	 bfio_test_pool_initialize_with_arena );
+
 	BFIO_TEST_RUN(
 	 "libbfio_pool_free",
 	 bfio_test_pool_free );
@@ -7363,6 +10647,26 @@ int main(
 	 "libbfio_pool_resize",
 	 bfio_test_pool_resize );
 
+	BFIO_TEST_RUN(
+	 "libbfio_pool_set_adaptive_maximum_number_of_open_handles",
+	 bfio_test_pool_set_adaptive_maximum_number_of_open_handles );
+
+	BFIO_TEST_RUN(
+	 "libbfio_pool_set_eviction_policy",
+	 bfio_test_pool_set_eviction_policy );
+
+	BFIO_TEST_RUN(
+	 "libbfio_pool_eviction_policy_lfu",
+	 bfio_test_pool_eviction_policy_lfu );
+
+	BFIO_TEST_RUN(
+	 "libbfio_pool_set_handle_pinned",
+	 bfio_test_pool_set_handle_pinned );
+
+	BFIO_TEST_RUN(
+	 "libbfio_pool_set_descriptor_manager",
+	 bfio_test_pool_set_descriptor_manager );
+
 	BFIO_TEST_RUN(
 	 "libbfio_pool_write_buffer",
 	 bfio_test_pool_write_buffer );
@@ -7448,6 +10752,28 @@ int main(
 		 bfio_test_pool_close_all,
 		 source );
 
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+		BFIO_TEST_RUN(
+		 "libbfio_pool_set_single_threaded_handles",
+		 bfio_test_pool_set_single_threaded_handles );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_set_pre_open_next_entry",
+		 bfio_test_pool_set_pre_open_next_entry,
+		 source );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT )
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_internal_pool_pre_open_handle",
+		 bfio_test_internal_pool_pre_open_handle,
+		 source );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) && defined( LIBBFIO_HAVE_MULTI_THREAD_SUPPORT ) */
+
 		/* Initialize test
 		 */
 		result = bfio_test_pool_open_source(
@@ -7504,6 +10830,21 @@ int main(
 		 bfio_test_pool_read_buffer_at_offset,
 		 pool );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_set_error_mode",
+		 bfio_test_pool_set_error_mode,
+		 pool );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_get_lock_statistics",
+		 bfio_test_pool_get_lock_statistics,
+		 pool );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_set_trace_callbacks",
+		 bfio_test_pool_set_trace_callbacks,
+		 pool );
+
 		BFIO_TEST_RUN_WITH_ARGS(
 		 "libbfio_pool_seek_offset",
 		 bfio_test_pool_seek_offset,
@@ -7519,6 +10860,16 @@ int main(
 		 bfio_test_pool_get_size,
 		 pool );
 
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_prefetch",
+		 bfio_test_pool_prefetch,
+		 pool );
+
+		BFIO_TEST_RUN_WITH_ARGS(
+		 "libbfio_pool_set_access_hint",
+		 bfio_test_pool_set_access_hint,
+		 pool );
+
 		/* Clean up
 		 */
 		result = bfio_test_pool_close_source(
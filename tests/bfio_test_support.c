@@ -163,6 +163,136 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libbfio_get_lock_type function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_get_lock_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int lock_type            = 0;
+	int result               = 0;
+
+	result = libbfio_get_lock_type(
+	          &lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_get_lock_type(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_set_lock_type function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_set_lock_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int lock_type            = 0;
+	int result               = 0;
+
+	result = libbfio_get_lock_type(
+	          &lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_set_lock_type(
+	          LIBBFIO_LOCK_TYPE_READ_WRITE_LOCK,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_set_lock_type(
+	          lock_type,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_set_lock_type(
+	          -1,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -182,6 +312,14 @@ int main(
 	 "libbfio_get_version",
 	 bfio_test_get_version );
 
+	BFIO_TEST_RUN(
+	 "libbfio_get_lock_type",
+	 bfio_test_get_lock_type );
+
+	BFIO_TEST_RUN(
+	 "libbfio_set_lock_type",
+	 bfio_test_set_lock_type );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -37,6 +37,179 @@
 
 #if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
 
+/* Tests the libbfio_system_string_get_ascii_narrow_string_length function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_system_string_get_ascii_narrow_string_length(
+     void )
+{
+	char ascii_string[]     = "Test string with more than 16 characters";
+	char embedded_string[]  = "Test string with\0 an end-of-string";
+	char non_ascii_string[] = "Test string with a non-ASCII \xc3\xa9 character";
+
+	libcerror_error_t *error = NULL;
+	size_t length            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          ascii_string,
+	          sizeof( ascii_string ) / sizeof( char ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "length",
+	 length,
+	 (size_t) 40 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          ascii_string,
+	          4,
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "length",
+	 length,
+	 (size_t) 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          embedded_string,
+	          sizeof( embedded_string ) / sizeof( char ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "length",
+	 length,
+	 (size_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          non_ascii_string,
+	          sizeof( non_ascii_string ) / sizeof( char ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          ascii_string,
+	          0,
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          NULL,
+	          sizeof( ascii_string ) / sizeof( char ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          ascii_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_system_string_get_ascii_narrow_string_length(
+	          ascii_string,
+	          sizeof( ascii_string ) / sizeof( char ),
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libbfio_system_string_size_to_narrow_string function
  * Returns 1 if successful or 0 if not
  */
@@ -549,6 +722,179 @@ on_error:
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
+/* Tests the libbfio_system_string_get_ascii_wide_string_length function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_system_string_get_ascii_wide_string_length(
+     void )
+{
+	wchar_t ascii_string[]     = L"Test string with more than 16 characters";
+	wchar_t embedded_string[]  = L"Test string with\0 an end-of-string";
+	wchar_t non_ascii_string[] = L"Test string with a non-ASCII \x00e9 character";
+
+	libcerror_error_t *error = NULL;
+	size_t length            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          ascii_string,
+	          sizeof( ascii_string ) / sizeof( wchar_t ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "length",
+	 length,
+	 (size_t) 40 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          ascii_string,
+	          4,
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "length",
+	 length,
+	 (size_t) 4 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          embedded_string,
+	          sizeof( embedded_string ) / sizeof( wchar_t ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_SIZE(
+	 "length",
+	 length,
+	 (size_t) 16 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          non_ascii_string,
+	          sizeof( non_ascii_string ) / sizeof( wchar_t ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          ascii_string,
+	          0,
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          NULL,
+	          sizeof( ascii_string ) / sizeof( wchar_t ),
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          ascii_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &length,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_system_string_get_ascii_wide_string_length(
+	          ascii_string,
+	          sizeof( ascii_string ) / sizeof( wchar_t ),
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libbfio_system_string_size_to_wide_string function
  * Returns 1 if successful or 0 if not
  */
@@ -1076,6 +1422,10 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
 
+	BFIO_TEST_RUN(
+	 "libbfio_system_string_get_ascii_narrow_string_length",
+	 bfio_test_system_string_get_ascii_narrow_string_length );
+
 	BFIO_TEST_RUN(
 	 "libbfio_system_string_size_to_narrow_string",
 	 bfio_test_system_string_size_to_narrow_string );
@@ -1094,6 +1444,10 @@ int main(
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
+	BFIO_TEST_RUN(
+	 "libbfio_system_string_get_ascii_wide_string_length",
+	 bfio_test_system_string_get_ascii_wide_string_length );
+
 	BFIO_TEST_RUN(
 	 "libbfio_system_string_size_to_wide_string",
 	 bfio_test_system_string_size_to_wide_string );
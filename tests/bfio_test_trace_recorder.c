@@ -0,0 +1,770 @@
+/*
+ * Library trace_recorder type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bfio_test_libbfio.h"
+#include "bfio_test_libcerror.h"
+#include "bfio_test_macros.h"
+#include "bfio_test_memory.h"
+#include "bfio_test_unused.h"
+
+#include "../libbfio/libbfio_trace_recorder.h"
+
+uint8_t bfio_test_trace_recorder_data[ 256 ];
+
+/* Creates a memory range handle that is open for writing
+ * Returns 1 if successful or -1 on error
+ */
+int bfio_test_trace_recorder_output_handle_initialize(
+     libbfio_handle_t **handle,
+     libcerror_error_t **error )
+{
+	if( memory_set(
+	     bfio_test_trace_recorder_data,
+	     0,
+	     256 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     *handle,
+	     bfio_test_trace_recorder_data,
+	     256,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *handle,
+	     LIBBFIO_OPEN_WRITE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *handle != NULL )
+	{
+		libbfio_handle_free(
+		 handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libbfio_trace_recorder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_trace_recorder_initialize(
+     void )
+{
+	libbfio_handle_t *output_handle          = NULL;
+	libbfio_trace_recorder_t *trace_recorder = NULL;
+	libcerror_error_t *error                 = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 2;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = bfio_test_trace_recorder_output_handle_initialize(
+	          &output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "output_handle",
+	 output_handle );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libbfio_trace_recorder_initialize(
+	          &trace_recorder,
+	          output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "trace_recorder",
+	 trace_recorder );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          bfio_test_trace_recorder_data,
+	          "bfiotrc",
+	          8 );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_trace_recorder_free(
+	          &trace_recorder,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "trace_recorder",
+	 trace_recorder );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_trace_recorder_initialize(
+	          NULL,
+	          output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	trace_recorder = (libbfio_trace_recorder_t *) 0x12345678UL;
+
+	result = libbfio_trace_recorder_initialize(
+	          &trace_recorder,
+	          output_handle,
+	          &error );
+
+	trace_recorder = NULL;
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_trace_recorder_initialize(
+	          &trace_recorder,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_BFIO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_trace_recorder_initialize with malloc failing
+		 */
+		bfio_test_malloc_attempts_before_fail = test_number;
+
+		result = libbfio_trace_recorder_initialize(
+		          &trace_recorder,
+		          output_handle,
+		          &error );
+
+		if( bfio_test_malloc_attempts_before_fail != -1 )
+		{
+			bfio_test_malloc_attempts_before_fail = -1;
+
+			if( trace_recorder != NULL )
+			{
+				libbfio_trace_recorder_free(
+				 &trace_recorder,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "trace_recorder",
+			 trace_recorder );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libbfio_trace_recorder_initialize with memset failing
+		 */
+		bfio_test_memset_attempts_before_fail = test_number;
+
+		result = libbfio_trace_recorder_initialize(
+		          &trace_recorder,
+		          output_handle,
+		          &error );
+
+		if( bfio_test_memset_attempts_before_fail != -1 )
+		{
+			bfio_test_memset_attempts_before_fail = -1;
+
+			if( trace_recorder != NULL )
+			{
+				libbfio_trace_recorder_free(
+				 &trace_recorder,
+				 NULL );
+			}
+		}
+		else
+		{
+			BFIO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			BFIO_TEST_ASSERT_IS_NULL(
+			 "trace_recorder",
+			 trace_recorder );
+
+			BFIO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_BFIO_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace_recorder != NULL )
+	{
+		libbfio_trace_recorder_free(
+		 &trace_recorder,
+		 NULL );
+	}
+	if( output_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &output_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_trace_recorder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_trace_recorder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libbfio_trace_recorder_free(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_trace_recorder_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_trace_recorder_flush(
+     libbfio_trace_recorder_t *trace_recorder )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_trace_recorder_flush(
+	          trace_recorder,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_trace_recorder_flush(
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libbfio_trace_recorder_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_trace_recorder_get_number_of_records(
+     libbfio_trace_recorder_t *trace_recorder )
+{
+	libcerror_error_t *error   = NULL;
+	uint64_t number_of_records = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libbfio_trace_recorder_get_number_of_records(
+	          trace_recorder,
+	          &number_of_records,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libbfio_trace_recorder_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libbfio_trace_recorder_get_number_of_records(
+	          trace_recorder,
+	          NULL,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+/* Tests the libbfio_trace_recorder_post_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int bfio_test_trace_recorder_post_callback(
+     libbfio_trace_recorder_t *trace_recorder )
+{
+	libcerror_error_t *error   = NULL;
+	uint64_t number_of_records = 0;
+	uint64_t value_64bit       = 0;
+	uint32_t value_32bit       = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	libbfio_trace_recorder_post_callback(
+	 (intptr_t *) trace_recorder,
+	 LIBBFIO_TRACE_OPERATION_READ,
+	 3,
+	 512,
+	 64,
+	 64,
+	 1000 );
+
+	result = libbfio_trace_recorder_get_number_of_records(
+	          trace_recorder,
+	          &number_of_records,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_records",
+	 number_of_records,
+	 (uint64_t) 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_trace_recorder_flush(
+	          trace_recorder,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record follows the 16 byte file header
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 &( bfio_test_trace_recorder_data[ 16 + 8 ] ),
+	 value_64bit );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "duration",
+	 value_64bit,
+	 (uint64_t) 1000 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( bfio_test_trace_recorder_data[ 16 + 16 ] ),
+	 value_64bit );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT64(
+	 "offset",
+	 value_64bit,
+	 (uint64_t) 512 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( bfio_test_trace_recorder_data[ 16 + 40 ] ),
+	 value_32bit );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT32(
+	 "entry",
+	 value_32bit,
+	 (uint32_t) 3 );
+
+	BFIO_TEST_ASSERT_EQUAL_UINT8(
+	 "operation",
+	 bfio_test_trace_recorder_data[ 16 + 44 ],
+	 (uint8_t) LIBBFIO_TRACE_OPERATION_READ );
+
+	/* Test error cases
+	 */
+	libbfio_trace_recorder_post_callback(
+	 NULL,
+	 LIBBFIO_TRACE_OPERATION_READ,
+	 3,
+	 512,
+	 64,
+	 64,
+	 1000 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc BFIO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] BFIO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libbfio_handle_t *output_handle          = NULL;
+	libbfio_trace_recorder_t *trace_recorder = NULL;
+	libcerror_error_t *error                 = NULL;
+	int result                               = 0;
+
+	BFIO_TEST_UNREFERENCED_PARAMETER( argc )
+	BFIO_TEST_UNREFERENCED_PARAMETER( argv )
+
+	BFIO_TEST_RUN(
+	 "libbfio_trace_recorder_initialize",
+	 bfio_test_trace_recorder_initialize );
+
+	BFIO_TEST_RUN(
+	 "libbfio_trace_recorder_free",
+	 bfio_test_trace_recorder_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize trace recorder for tests
+	 */
+	result = bfio_test_trace_recorder_output_handle_initialize(
+	          &output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_trace_recorder_initialize(
+	          &trace_recorder,
+	          output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NOT_NULL(
+	 "trace_recorder",
+	 trace_recorder );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_trace_recorder_flush",
+	 bfio_test_trace_recorder_flush,
+	 trace_recorder );
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_trace_recorder_get_number_of_records",
+	 bfio_test_trace_recorder_get_number_of_records,
+	 trace_recorder );
+
+#if defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT )
+
+	BFIO_TEST_RUN_WITH_ARGS(
+	 "libbfio_trace_recorder_post_callback",
+	 bfio_test_trace_recorder_post_callback,
+	 trace_recorder );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBBFIO_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libbfio_trace_recorder_free(
+	          &trace_recorder,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &output_handle,
+	          &error );
+
+	BFIO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	BFIO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace_recorder != NULL )
+	{
+		libbfio_trace_recorder_free(
+		 &trace_recorder,
+		 NULL );
+	}
+	if( output_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &output_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "error support system_string"
-$LibraryTestsWithInput = "file file_io_handle file_pool file_range file_range_io_handle handle memory_range memory_range_io_handle pool"
+$LibraryTests = "arena descriptor_manager error lock support system_string trace_recorder trace_replay"
+$LibraryTestsWithInput = "file file_io_handle file_pool file_range file_range_io_handle handle handle_range memory_range memory_range_io_handle pool pool_span"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1